@@ -0,0 +1,147 @@
+/******************************************************************************
+
+    @file    StateOS: oschannel.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#ifndef __STATEOS_CHN_H
+#define __STATEOS_CHN_H
+
+#include "oskernel.h"
+#include "osmailboxqueue.h"
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+
+#include <new>
+#include <utility>
+
+/******************************************************************************
+ *
+ * Class             : Channel<>
+ *
+ * Description       : create and initialize a typed channel object
+ *                     mails are constructed in place in the channel storage and are move-extracted,
+ *                     so non-trivially-copyable objects (e.g. std::function, std::unique_ptr) can be passed
+ *                     indices of free and filled slots are passed through mailbox queues,
+ *                     so the channel uses the kernel wait queues for blocking
+ *
+ * Constructor parameters
+ *   limit           : size of a queue (max number of stored mails)
+ *   T               : class of a single mail
+ *
+ * Note              : the mail is constructed from the arguments of give / send functions
+ *                     and is moved to the object passed to take / wait functions
+ *
+ ******************************************************************************/
+
+template<unsigned limit_, class T>
+struct Channel
+{
+	Channel( void )
+	{
+		for (unsigned i = 0; i < limit_; i++)
+			free_.give(&i);
+	}
+
+	~Channel( void )
+	{
+		unsigned i;
+		while (full_.take(&i) == E_SUCCESS)
+			slot(i)->~T();
+	}
+
+	Channel( const Channel& ) = delete;
+	Channel& operator=( const Channel& ) = delete;
+
+	template<class... A>
+	unsigned give     (                 A&&... _args )    { unsigned i; return put(free_.take     (&i),         &i, std::forward<A>(_args)...); }
+	template<class... A>
+	unsigned giveISR  (                 A&&... _args )    { unsigned i; return put(free_.takeISR  (&i),         &i, std::forward<A>(_args)...); }
+	template<class... A>
+	unsigned sendFor  ( cnt_t _delay,   A&&... _args )    { unsigned i; return put(free_.waitFor  (&i, _delay), &i, std::forward<A>(_args)...); }
+	template<class... A>
+	unsigned sendUntil( cnt_t _time,    A&&... _args )    { unsigned i; return put(free_.waitUntil(&i, _time),  &i, std::forward<A>(_args)...); }
+	template<class... A>
+	unsigned send     (                 A&&... _args )    { unsigned i; return put(free_.wait     (&i),         &i, std::forward<A>(_args)...); }
+	template<class... A>
+	unsigned emplace  (                 A&&... _args )    { return send(std::forward<A>(_args)...); }
+
+	unsigned take     ( T& _data )                        { unsigned i; return get(full_.take     (&i),         &i, _data); }
+	unsigned tryWait  ( T& _data )                        { unsigned i; return get(full_.tryWait  (&i),         &i, _data); }
+	unsigned takeISR  ( T& _data )                        { unsigned i; return get(full_.takeISR  (&i),         &i, _data); }
+	unsigned waitFor  ( T& _data, cnt_t _delay )          { unsigned i; return get(full_.waitFor  (&i, _delay), &i, _data); }
+	unsigned waitUntil( T& _data, cnt_t _time )           { unsigned i; return get(full_.waitUntil(&i, _time),  &i, _data); }
+	unsigned wait     ( T& _data )                        { unsigned i; return get(full_.wait     (&i),         &i, _data); }
+
+	unsigned count    ( void )                            { return full_.count   ();     }
+	unsigned countISR ( void )                            { return full_.countISR();     }
+	unsigned space    ( void )                            { return free_.count   ();     }
+	unsigned spaceISR ( void )                            { return free_.countISR();     }
+	unsigned limit    ( void )                            { return limit_;               }
+	unsigned limitISR ( void )                            { return limit_;               }
+
+	private:
+	MailBoxQueueTT<limit_, unsigned> free_; // indices of free slots
+	MailBoxQueueTT<limit_, unsigned> full_; // indices of filled slots, in order of sending
+	typename std::aligned_storage<sizeof(T), alignof(T)>::type data_[limit_];
+
+	T *slot( unsigned i ) { return reinterpret_cast<T *>(&data_[i]); }
+
+	// construct the mail in the free slot taken and pass its index to the receivers
+	template<class... A>
+	unsigned put( unsigned event, unsigned *i, A&&... _args )
+	{
+		if (event == E_SUCCESS)
+		{
+			new (slot(*i)) T(std::forward<A>(_args)...);
+			event = full_.give(i);
+		}
+		return event;
+	}
+
+	// move the mail out of the filled slot taken and give back the slot
+	unsigned get( unsigned event, unsigned *i, T& _data )
+	{
+		if (event == E_SUCCESS)
+		{
+			_data = std::move(*slot(*i));
+			slot(*i)->~T();
+			event = free_.give(i);
+		}
+		return event;
+	}
+};
+
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_CHN_H
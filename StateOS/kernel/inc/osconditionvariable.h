@@ -320,6 +320,7 @@ unsigned cnd_wait( cnd_t *cnd, mtx_t *mtx ) { return cnd_waitFor(cnd, mtx, INFIN
  * Return            : none
  *
  * Note              : may be used both in thread and handler mode
+ *                     in thread mode, signaled tasks are moved directly to the mutex queue if the mutex is locked
  *
  ******************************************************************************/
 
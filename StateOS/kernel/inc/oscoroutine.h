@@ -0,0 +1,469 @@
+/******************************************************************************
+
+    @file    StateOS: oscoroutine.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#ifndef __STATEOS_COR_H
+#define __STATEOS_COR_H
+
+#include "oskernel.h"
+#include "ossemaphore.h"
+#include "osmemorypool.h"
+#include "osmailboxqueue.h"
+#include "oseventqueue.h"
+#include "ostask.h"
+#include "ospoll.h"
+
+/* -------------------------------------------------------------------------- */
+
+#if defined(__cplusplus) && defined(__cpp_impl_coroutine)
+
+#include <coroutine>
+
+struct CoScheduler;
+struct CoAwaiter;
+struct Coroutine;
+
+/******************************************************************************
+ *
+ * Class             : CoPromise
+ *
+ * Description       : promise of a coroutine run by the coroutine scheduler
+ *                     the first parameter of the coroutine must be a reference to the scheduler,
+ *                     the coroutine frame is taken from the memory pool of the scheduler
+ *                     and the coroutine is queued to the scheduler as soon as it is called
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+struct CoPromise
+{
+	template<class... A>
+	CoPromise( CoScheduler &_sch, A&&... );
+
+	template<class... A>
+	static void *operator new   ( size_t _size, CoScheduler &_sch, A&&... ) noexcept;
+	static void  operator delete( void *_ptr, size_t _size ) noexcept;
+	static size_t trailer( size_t _size ) { return (_size + sizeof(mem_t *) - 1) / sizeof(mem_t *) * sizeof(mem_t *); }
+
+	Coroutine           get_return_object( void );
+	static Coroutine    get_return_object_on_allocation_failure( void );
+	std::suspend_always initial_suspend( void ) noexcept { return {}; }
+	std::suspend_always final_suspend  ( void ) noexcept { return {}; }
+	void                return_void    ( void )          {}
+	void                unhandled_exception( void )      { assert(false); }
+
+	CoScheduler * sch_;   // owner of the coroutine
+	CoAwaiter   * wait_;  // awaiter of the suspended coroutine
+	cnt_t         start_; // time of suspension
+	CoPromise   * next_;  // next coroutine in the ready / waiting queue
+};
+
+/******************************************************************************
+ *
+ * Class             : Coroutine
+ *
+ * Description       : return type of the coroutine run by the coroutine scheduler
+ *                     the coroutine frame is owned by the scheduler and released after the coroutine returns
+ *
+ * Note              : operator! returns true if the coroutine was not created (not enough free frames)
+ *
+ ******************************************************************************/
+
+struct Coroutine
+{
+	using promise_type = CoPromise;
+
+	bool operator!( void ) const { return prm_ == nullptr; }
+
+	CoPromise *prm_;
+};
+
+/******************************************************************************
+ *
+ * Class             : CoAwaiter
+ *
+ * Description       : awaitable wait for a kernel object and / or a timeout
+ *                     the object is polled with the poll services (sys_waitAny) by the scheduler task,
+ *                     so the waiting coroutines are registered in the object's list of pollers
+ *
+ * Return            : (of co_await expression)
+ *   E_SUCCESS       : the object was successfully taken
+ *   E_TIMEOUT       : the object was not taken before the specified timeout expired
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+struct CoAwaiter
+{
+	bool     await_ready  ( void )
+	{
+		if (take_ != nullptr && take_(this) == E_SUCCESS) { event_ = E_SUCCESS; return true; }
+		if (delay_ == IMMEDIATE)                          { event_ = E_TIMEOUT; return true; }
+		return false;
+	}
+	void     await_suspend( std::coroutine_handle<CoPromise> _h );
+	unsigned await_resume ( void ) { return event_; }
+
+	pol_t      pol_;                      // poller of the awaited object (pol_.obj == nullptr: timeout only)
+	unsigned (*take_)( CoAwaiter * );     // procedure taking the awaited object without waiting
+	void     * data_;                     // buffer for the received data
+	cnt_t      delay_;                    // duration of time to wait
+	unsigned   event_;                    // result of waiting
+};
+
+/******************************************************************************
+ *
+ * Class             : CoScheduler
+ *
+ * Description       : base class of the coroutine scheduler
+ *                     all the coroutines of the scheduler are run by the single task calling 'run'
+ *
+ * Note              : use CoSchedulerT<> to create the scheduler object
+ *
+ ******************************************************************************/
+
+struct CoScheduler
+{
+	CoScheduler( mem_t *_mem, unsigned _size, pol_t *_pol, CoPromise **_map ):
+		pool_(_mem), frame_(_size), list_(_pol), prms_(_map), ready_(nullptr), tail_(&ready_), wait_(nullptr), last_(&wait_), count_(0) {}
+
+	CoScheduler( const CoScheduler& ) = delete;
+	CoScheduler& operator=( const CoScheduler& ) = delete;
+
+/******************************************************************************
+ *
+ * Name              : run
+ *
+ * Description       : run all the coroutines of the scheduler until they return,
+ *                     wait for kernel objects and timeouts of the suspended coroutines
+ *
+ * Return            : number of coroutines still suspended (deadlocked on coroutine mutexes)
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+	unsigned run( void )
+	{
+		CoPromise *prm;
+
+		while (count_ > 0)
+		{
+			while ((prm = ready_) != nullptr)
+			{
+				if ((ready_ = prm->next_) == nullptr)
+					tail_ = &ready_;
+				auto h = std::coroutine_handle<CoPromise>::from_promise(*prm);
+				h.resume();
+				if (h.done())
+				{
+					h.destroy();
+					count_--;
+				}
+			}
+
+			if (wait_ == nullptr)
+				break;
+
+			poll();
+		}
+
+		return count_;
+	}
+
+	unsigned count( void ) { return count_; }
+
+	void *alloc( size_t _size )
+	{
+		void *ptr;
+		if (CoPromise::trailer(_size) + sizeof(mem_t *) > frame_ || mem_take(pool_, &ptr) != E_SUCCESS)
+			return nullptr;
+		*reinterpret_cast<mem_t **>(static_cast<char *>(ptr) + CoPromise::trailer(_size)) = pool_;
+		count_++;
+		return ptr;
+	}
+
+	void ready( CoPromise *_prm )
+	{
+		_prm->next_ = nullptr;
+		*tail_ = _prm;
+		tail_ = &_prm->next_;
+	}
+
+	void suspend( CoPromise *_prm, CoAwaiter *_wait )
+	{
+		_prm->wait_  = _wait;
+		_prm->start_ = core_sys_time();
+		_prm->next_  = nullptr;
+		*last_ = _prm;
+		last_ = &_prm->next_;
+	}
+
+	private:
+
+	void poll( void )
+	{
+		CoPromise * prm;
+		CoPromise **ptr;
+		CoAwaiter * wait;
+		cnt_t       delay = INFINITE;
+		cnt_t       now   = core_sys_time();
+		unsigned    n     = 0;
+
+		for (prm = wait_; prm != nullptr; prm = prm->next_)
+		{
+			wait = prm->wait_;
+			if (wait->pol_.obj != nullptr)
+			{
+				list_[n] = wait->pol_;
+				prms_[n++] = prm;
+			}
+			if (wait->delay_ != INFINITE)
+			{
+				cnt_t past = now - prm->start_;
+				cnt_t left = past < wait->delay_ ? wait->delay_ - past : 0;
+				if (delay == INFINITE || left < delay)
+					delay = left;
+			}
+		}
+
+		if (n > 0)
+			sys_waitAny(list_, n, delay);
+		else
+		if (delay != IMMEDIATE)
+			tsk_sleepFor(delay);
+
+		now = core_sys_time();
+		for (ptr = &wait_; (prm = *ptr) != nullptr; )
+		{
+			wait = prm->wait_;
+			if (wait->take_ != nullptr && wait->take_(wait) == E_SUCCESS)
+				wait->event_ = E_SUCCESS;
+			else
+			if (wait->delay_ != INFINITE && now - prm->start_ >= wait->delay_)
+				wait->event_ = E_TIMEOUT;
+			else
+			{
+				ptr = &prm->next_;
+				continue;
+			}
+			*ptr = prm->next_;
+			ready(prm);
+		}
+		last_ = ptr;
+	}
+
+	mem_t     * pool_;  // memory pool of coroutine frames
+	unsigned    frame_; // size of a coroutine frame
+	pol_t     * list_;  // pollers of the awaited objects
+	CoPromise** prms_;  // coroutines assigned to the pollers
+	CoPromise * ready_; // queue of coroutines ready to run
+	CoPromise** tail_;  // tail of the ready queue
+	CoPromise * wait_;  // queue of coroutines waiting for objects or timeouts
+	CoPromise** last_;  // tail of the waiting queue
+	unsigned    count_; // number of coroutines
+};
+
+/******************************************************************************
+ *
+ * Class             : CoSchedulerT<>
+ *
+ * Description       : create and initialize a coroutine scheduler object
+ *
+ * Constructor parameters
+ *   limit           : max number of coroutines
+ *   size            : size of a coroutine frame (in bytes)
+ *
+ * Note              : coroutine, that needs more memory for its frame, is not created
+ *
+ ******************************************************************************/
+
+template<unsigned limit_, unsigned size_>
+struct CoSchedulerT : public CoScheduler
+{
+	CoSchedulerT( void ): CoScheduler(&mem_, size_, pol_, map_) {}
+
+	private:
+	MemoryPoolT<limit_, size_> mem_;
+	pol_t                      pol_[limit_];
+	CoPromise *                map_[limit_];
+};
+
+/* -------------------------------------------------------------------------- */
+
+template<class... A>
+CoPromise::CoPromise( CoScheduler &_sch, A&&... ): sch_(&_sch), wait_(nullptr), start_(0), next_(nullptr)
+{
+	_sch.ready(this);
+}
+
+template<class... A>
+void *CoPromise::operator new( size_t _size, CoScheduler &_sch, A&&... ) noexcept
+{
+	return _sch.alloc(_size);
+}
+
+inline
+void CoPromise::operator delete( void *_ptr, size_t _size ) noexcept
+{
+	mem_t *mem = *reinterpret_cast<mem_t **>(static_cast<char *>(_ptr) + trailer(_size));
+	mem_give(mem, _ptr);
+}
+
+inline
+Coroutine CoPromise::get_return_object( void ) { return Coroutine { this }; }
+
+inline
+Coroutine CoPromise::get_return_object_on_allocation_failure( void ) { return Coroutine { nullptr }; }
+
+inline
+void CoAwaiter::await_suspend( std::coroutine_handle<CoPromise> _h )
+{
+	_h.promise().sch_->suspend(&_h.promise(), this);
+}
+
+/******************************************************************************
+ *
+ * Class             : CoMutex
+ *
+ * Description       : create and initialize a coroutine mutex object
+ *                     the mutex serializes coroutines of one scheduler across their suspension points
+ *                     the ownership is passed directly to the first waiting coroutine
+ *
+ * Note              : usage: co_await mtx.lock(); ... mtx.unlock();
+ *
+ ******************************************************************************/
+
+struct CoMutex
+{
+	struct Lock
+	{
+		bool await_ready  ( void )
+		{
+			if (mtx_->owned_) return false;
+			mtx_->owned_ = true;
+			return true;
+		}
+		void await_suspend( std::coroutine_handle<CoPromise> _h )
+		{
+			CoPromise *prm = &_h.promise();
+			prm->next_ = nullptr;
+			*mtx_->tail_ = prm;
+			mtx_->tail_ = &prm->next_;
+		}
+		void await_resume ( void ) {}
+
+		CoMutex *mtx_;
+	};
+
+	CoMutex( void ): owned_(false), queue_(nullptr), tail_(&queue_) {}
+
+	CoMutex( const CoMutex& ) = delete;
+	CoMutex& operator=( const CoMutex& ) = delete;
+
+	Lock     lock   ( void ) { return Lock { this }; }
+	bool     tryLock( void ) { return Lock { this }.await_ready(); }
+	void     unlock ( void )
+	{
+		CoPromise *prm = queue_;
+		assert(owned_);
+		if (prm == nullptr) { owned_ = false; return; }
+		if ((queue_ = prm->next_) == nullptr)
+			tail_ = &queue_;
+		prm->sch_->ready(prm);
+	}
+
+	private:
+	bool        owned_; // the mutex is locked
+	CoPromise * queue_; // queue of coroutines waiting for the mutex
+	CoPromise** tail_;  // tail of the waiting queue
+};
+
+/******************************************************************************
+ *
+ * Class             : CoYield
+ *
+ * Description       : awaitable passing control to the next ready coroutine of the scheduler
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+struct CoYield
+{
+	bool await_ready  ( void ) { return false; }
+	void await_suspend( std::coroutine_handle<CoPromise> _h ) { _h.promise().sch_->ready(&_h.promise()); }
+	void await_resume ( void ) {}
+};
+
+/******************************************************************************
+ *
+ * Namespace         : ThisCoroutine
+ *
+ * Description       : provide set of awaitables for the current coroutine
+ *                     the awaitables return the event value (E_SUCCESS / E_TIMEOUT) of the wait
+ *
+ * Note              : usage: co_await ThisCoroutine::sleepFor(SEC); event = co_await ThisCoroutine::wait(evq, data);
+ *                     only semaphores, mailbox queues and event queues can be awaited
+ *                     resetting or deleting the awaited object is not reported to the coroutine
+ *
+ ******************************************************************************/
+
+namespace ThisCoroutine
+{
+	static inline unsigned priv_takeSem( CoAwaiter *_w ) { return sem_take(static_cast<sem_t *>(_w->pol_.obj)); }
+	static inline unsigned priv_takeBox( CoAwaiter *_w ) { return box_take(static_cast<box_t *>(_w->pol_.obj), _w->data_); }
+	static inline unsigned priv_takeEvq( CoAwaiter *_w ) { return evq_take(static_cast<evq_t *>(_w->pol_.obj), static_cast<unsigned *>(_w->data_)); }
+	static inline cnt_t    priv_delay  ( cnt_t _time )   { cnt_t _delay = _time - core_sys_time(); return (cnt_t)(_delay - 1) > ((CNT_MAX)>>1) ? IMMEDIATE : _delay; }
+
+	static inline CoYield   yield     ( void )                                       { return CoYield { };                                                                          }
+	static inline CoAwaiter sleepFor  ( cnt_t _delay )                               { return CoAwaiter { _POL_INIT(nullptr, 0, 0), nullptr, nullptr, _delay, 0 };                  }
+	static inline CoAwaiter sleepUntil( cnt_t _time )                                { return CoAwaiter { _POL_INIT(nullptr, 0, 0), nullptr, nullptr, priv_delay(_time), 0 };       }
+	static inline CoAwaiter waitFor   ( sem_t &_sem, cnt_t _delay )                  { return CoAwaiter { POL_SEM(&_sem), priv_takeSem, nullptr, _delay, 0 };                       }
+	static inline CoAwaiter wait      ( sem_t &_sem )                                { return CoAwaiter { POL_SEM(&_sem), priv_takeSem, nullptr, INFINITE, 0 };                     }
+	static inline CoAwaiter waitFor   ( box_t &_box, void *_data, cnt_t _delay )     { return CoAwaiter { POL_BOX(&_box), priv_takeBox, _data, _delay, 0 };                         }
+	static inline CoAwaiter wait      ( box_t &_box, void *_data )                   { return CoAwaiter { POL_BOX(&_box), priv_takeBox, _data, INFINITE, 0 };                       }
+	static inline CoAwaiter waitFor   ( evq_t &_evq, unsigned &_data, cnt_t _delay ) { return CoAwaiter { POL_EVQ(&_evq), priv_takeEvq, &_data, _delay, 0 };                        }
+	static inline CoAwaiter wait      ( evq_t &_evq, unsigned &_data )               { return CoAwaiter { POL_EVQ(&_evq), priv_takeEvq, &_data, INFINITE, 0 };                      }
+}
+
+/* -------------------------------------------------------------------------- */
+
+static inline
+CoAwaiter operator co_await( sem_t &_sem ) { return ThisCoroutine::wait(_sem); }
+
+#endif//__cplusplus && __cpp_impl_coroutine
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_COR_H
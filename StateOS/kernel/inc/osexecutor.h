@@ -0,0 +1,357 @@
+/******************************************************************************
+
+    @file    StateOS: osexecutor.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#ifndef __STATEOS_EXE_H
+#define __STATEOS_EXE_H
+
+#include "oskernel.h"
+#include "osmailboxqueue.h"
+#include "ossemaphore.h"
+
+/******************************************************************************
+ *
+ * Name              : executor (worker thread pool)
+ *
+ ******************************************************************************/
+
+typedef struct __exe * const exe_id;
+typedef struct __exj exj_t;
+
+struct __exj
+{
+	cbk_t  * fun;   // job procedure
+	void   * arg;   // job procedure argument
+	sem_t  * done;  // semaphore released after the job is completed (future)
+};
+
+struct __exe
+{
+	obj_t    obj;   // object header (tasks waiting for completion of all jobs)
+
+	box_t    box;   // queue of jobs shared by the worker tasks
+	tsk_t ** wrk;   // worker tasks
+	unsigned count; // number of worker tasks
+	unsigned pend;  // number of submitted and not yet completed jobs
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : exe_create
+ * Alias             : exe_new
+ *
+ * Description       : create and initialize a new executor object with 'count' worker tasks (wrk_create)
+ *
+ * Parameters
+ *   count           : number of worker tasks
+ *   prio            : priority of worker tasks
+ *   limit           : size of a queue (max number of stored jobs)
+ *
+ * Return            : pointer to executor object (executor successfully created)
+ *   0               : executor not created (not enough free memory)
+ *
+ * Note              : use only in thread mode
+ *                     worker tasks have stack of default size (OS_STACK_SIZE)
+ *                     jobs are taken by the first idle worker, so the load is distributed between all workers
+ *
+ ******************************************************************************/
+
+exe_t *exe_create( unsigned count, unsigned prio, unsigned limit );
+
+__STATIC_INLINE
+exe_t *exe_new( unsigned count, unsigned prio, unsigned limit ) { return exe_create(count, prio, limit); }
+
+/******************************************************************************
+ *
+ * Name              : exe_destroy
+ * Alias             : exe_delete
+ *
+ * Description       : wait for completion of all submitted jobs, stop and join all worker tasks,
+ *                     wake up all waiting tasks with 'E_DELETED' event value and free allocated resource
+ *
+ * Parameters
+ *   exe             : pointer to executor object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void exe_destroy( exe_t *exe );
+
+__STATIC_INLINE
+void exe_delete( exe_t *exe ) { exe_destroy(exe); }
+
+/******************************************************************************
+ *
+ * Name              : exe_give
+ * ISR alias         : exe_giveISR
+ *
+ * Description       : try to transfer job to the executor object,
+ *                     don't wait if the queue of jobs is full
+ *
+ * Parameters
+ *   exe             : pointer to executor object
+ *   fun             : pointer to job procedure
+ *   arg             : argument of job procedure
+ *   done            : pointer to semaphore released after the job is completed (future)
+ *                     0: no completion notification
+ *
+ * Return
+ *   E_SUCCESS       : job was successfully transferred to the executor object
+ *   E_TIMEOUT       : queue of jobs is full, try again
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+unsigned exe_give( exe_t *exe, cbk_t *fun, void *arg, sem_t *done );
+
+__STATIC_INLINE
+unsigned exe_giveISR( exe_t *exe, cbk_t *fun, void *arg, sem_t *done ) { return exe_give(exe, fun, arg, done); }
+
+/******************************************************************************
+ *
+ * Name              : exe_sendFor
+ *
+ * Description       : try to transfer job to the executor object,
+ *                     wait for given duration of time while the queue of jobs is full
+ *
+ * Parameters
+ *   exe             : pointer to executor object
+ *   fun             : pointer to job procedure
+ *   arg             : argument of job procedure
+ *   done            : pointer to semaphore released after the job is completed (future)
+ *                     0: no completion notification
+ *   delay           : duration of time (maximum number of ticks to wait while the queue of jobs is full)
+ *                     IMMEDIATE: don't wait if the queue of jobs is full
+ *                     INFINITE:  wait indefinitely while the queue of jobs is full
+ *
+ * Return
+ *   E_SUCCESS       : job was successfully transferred to the executor object
+ *   E_STOPPED       : executor object was reseted before the specified timeout expired
+ *   E_DELETED       : executor object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : queue of jobs is full and was not issued data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned exe_sendFor( exe_t *exe, cbk_t *fun, void *arg, sem_t *done, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : exe_sendUntil
+ *
+ * Description       : try to transfer job to the executor object,
+ *                     wait until given timepoint while the queue of jobs is full
+ *
+ * Parameters
+ *   exe             : pointer to executor object
+ *   fun             : pointer to job procedure
+ *   arg             : argument of job procedure
+ *   done            : pointer to semaphore released after the job is completed (future)
+ *                     0: no completion notification
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : job was successfully transferred to the executor object
+ *   E_STOPPED       : executor object was reseted before the specified timeout expired
+ *   E_DELETED       : executor object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : queue of jobs is full and was not issued data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned exe_sendUntil( exe_t *exe, cbk_t *fun, void *arg, sem_t *done, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : exe_send
+ *
+ * Description       : try to transfer job to the executor object,
+ *                     wait indefinitely while the queue of jobs is full
+ *
+ * Parameters
+ *   exe             : pointer to executor object
+ *   fun             : pointer to job procedure
+ *   arg             : argument of job procedure
+ *   done            : pointer to semaphore released after the job is completed (future)
+ *                     0: no completion notification
+ *
+ * Return
+ *   E_SUCCESS       : job was successfully transferred to the executor object
+ *   E_STOPPED       : executor object was reseted
+ *   E_DELETED       : executor object was deleted
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+unsigned exe_send( exe_t *exe, cbk_t *fun, void *arg, sem_t *done ) { return exe_sendFor(exe, fun, arg, done, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : exe_waitFor
+ *
+ * Description       : wait for given duration of time for completion of all submitted jobs (drain)
+ *
+ * Parameters
+ *   exe             : pointer to executor object
+ *   delay           : duration of time (maximum number of ticks to wait for completion of all jobs)
+ *                     IMMEDIATE: don't wait if there are uncompleted jobs
+ *                     INFINITE:  wait indefinitely for completion of all jobs
+ *
+ * Return
+ *   E_SUCCESS       : all submitted jobs have been completed
+ *   E_DELETED       : executor object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : jobs have not been completed before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned exe_waitFor( exe_t *exe, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : exe_waitUntil
+ *
+ * Description       : wait until given timepoint for completion of all submitted jobs (drain)
+ *
+ * Parameters
+ *   exe             : pointer to executor object
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : all submitted jobs have been completed
+ *   E_DELETED       : executor object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : jobs have not been completed before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned exe_waitUntil( exe_t *exe, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : exe_wait
+ *
+ * Description       : wait indefinitely for completion of all submitted jobs (drain)
+ *
+ * Parameters
+ *   exe             : pointer to executor object
+ *
+ * Return
+ *   E_SUCCESS       : all submitted jobs have been completed
+ *   E_DELETED       : executor object was deleted
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+unsigned exe_wait( exe_t *exe ) { return exe_waitFor(exe, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : exe_count
+ * ISR alias         : exe_countISR
+ *
+ * Description       : return the number of submitted and not yet completed jobs
+ *
+ * Parameters
+ *   exe             : pointer to executor object
+ *
+ * Return            : number of uncompleted jobs
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+unsigned exe_count( exe_t *exe ) { return exe->pend; }
+
+__STATIC_INLINE
+unsigned exe_countISR( exe_t *exe ) { return exe_count(exe); }
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+
+/******************************************************************************
+ *
+ * Class             : Executor
+ *
+ * Description       : use an executor object (worker thread pool)
+ *
+ * Note              : executor object can only be created dynamically
+ *
+ ******************************************************************************/
+
+struct Executor : public __exe
+{
+	static
+	Executor *create( unsigned _count, unsigned _prio, unsigned _limit )
+	{
+		return reinterpret_cast<Executor *>(exe_create(_count, _prio, _limit));
+	}
+
+	void     destroy  ( void )                                                {        exe_destroy  (this);                            }
+	unsigned give     ( cbk_t *_fun, void *_arg, sem_t *_done = nullptr )     { return exe_give     (this, _fun, _arg, _done);         }
+	unsigned giveISR  ( cbk_t *_fun, void *_arg, sem_t *_done = nullptr )     { return exe_giveISR  (this, _fun, _arg, _done);         }
+	unsigned sendFor  ( cbk_t *_fun, void *_arg, sem_t *_done, cnt_t _delay ) { return exe_sendFor  (this, _fun, _arg, _done, _delay); }
+	unsigned sendUntil( cbk_t *_fun, void *_arg, sem_t *_done, cnt_t _time )  { return exe_sendUntil(this, _fun, _arg, _done, _time);  }
+	unsigned send     ( cbk_t *_fun, void *_arg, sem_t *_done = nullptr )     { return exe_send     (this, _fun, _arg, _done);         }
+	unsigned waitFor  ( cnt_t _delay )                                        { return exe_waitFor  (this, _delay);                    }
+	unsigned waitUntil( cnt_t _time )                                         { return exe_waitUntil(this, _time);                     }
+	unsigned wait     ( void )                                                { return exe_wait     (this);                            }
+	unsigned count    ( void )                                                { return exe_count    (this);                            }
+	unsigned countISR ( void )                                                { return exe_countISR (this);                            }
+};
+
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_EXE_H
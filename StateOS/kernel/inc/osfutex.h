@@ -0,0 +1,195 @@
+/******************************************************************************
+
+    @file    StateOS: osfutex.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#ifndef __STATEOS_FUT_H
+#define __STATEOS_FUT_H
+
+#include "oskernel.h"
+
+/******************************************************************************
+ *
+ * Name              : futex (wait-on-address)
+ *                     like a linux futex
+ *
+ ******************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : fut_waitFor
+ *
+ * Description       : wait for given duration of time on the address 'addr',
+ *                     if the value pointed to by 'addr' is still equal to 'value'
+ *                     the check and the wait are atomic with respect to fut_wake
+ *
+ * Parameters
+ *   addr            : address of user variable
+ *   value           : expected value of user variable
+ *   delay           : duration of time (maximum number of ticks to wait)
+ *                     IMMEDIATE: don't wait
+ *                     INFINITE:  wait indefinitely until woken up
+ *
+ * Return
+ *   E_SUCCESS       : task was woken up by fut_wake
+ *   E_FAILURE       : value of user variable was not equal to 'value', try again
+ *   E_TIMEOUT       : task was not woken up before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned fut_waitFor( volatile unsigned *addr, unsigned value, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : fut_waitUntil
+ *
+ * Description       : wait until given timepoint on the address 'addr',
+ *                     if the value pointed to by 'addr' is still equal to 'value'
+ *                     the check and the wait are atomic with respect to fut_wake
+ *
+ * Parameters
+ *   addr            : address of user variable
+ *   value           : expected value of user variable
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : task was woken up by fut_wake
+ *   E_FAILURE       : value of user variable was not equal to 'value', try again
+ *   E_TIMEOUT       : task was not woken up before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned fut_waitUntil( volatile unsigned *addr, unsigned value, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : fut_wait
+ *
+ * Description       : wait indefinitely on the address 'addr',
+ *                     if the value pointed to by 'addr' is still equal to 'value'
+ *                     the check and the wait are atomic with respect to fut_wake
+ *
+ * Parameters
+ *   addr            : address of user variable
+ *   value           : expected value of user variable
+ *
+ * Return
+ *   E_SUCCESS       : task was woken up by fut_wake
+ *   E_FAILURE       : value of user variable was not equal to 'value', try again
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+unsigned fut_wait( volatile unsigned *addr, unsigned value ) { return fut_waitFor(addr, value, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : fut_wake
+ * ISR alias         : fut_wakeISR
+ *
+ * Description       : resume execution of up to 'count' tasks waiting on the address 'addr'
+ *                     tasks are resumed in the order of their priorities
+ *
+ * Parameters
+ *   addr            : address of user variable
+ *   count           : maximum number of tasks to resume
+ *                     1: resume one task
+ *                     UINT_MAX: resume all tasks
+ *
+ * Return            : number of resumed tasks
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+unsigned fut_wake( volatile unsigned *addr, unsigned count );
+
+__STATIC_INLINE
+unsigned fut_wakeISR( volatile unsigned *addr, unsigned count ) { return fut_wake(addr, count); }
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+
+#include <atomic>
+
+/******************************************************************************
+ *
+ * Class             : Futex
+ *
+ * Description       : use an atomic variable with wait / notify functions
+ *                     like std::atomic<unsigned> with c++20 wait / notify_one / notify_all
+ *
+ * Constructor parameters
+ *   init            : initial value of the atomic variable
+ *
+ ******************************************************************************/
+
+struct Futex : public std::atomic<unsigned>
+{
+	Futex( const unsigned _init = 0 ): std::atomic<unsigned>(_init) {}
+
+	using std::atomic<unsigned>::operator=;
+
+	unsigned waitFor  ( unsigned _old, cnt_t _delay ) { return fut_waitFor  (addr(), _old, _delay); }
+	unsigned waitUntil( unsigned _old, cnt_t _time )  { return fut_waitUntil(addr(), _old, _time);  }
+	unsigned wait     ( unsigned _old )               { return fut_wait     (addr(), _old);         }
+	unsigned notify_one     ( void )                  { return fut_wake     (addr(), 1);            }
+	unsigned notify_oneISR  ( void )                  { return fut_wakeISR  (addr(), 1);            }
+	unsigned notify_all     ( void )                  { return fut_wake     (addr(), UINT_MAX);     }
+	unsigned notify_allISR  ( void )                  { return fut_wakeISR  (addr(), UINT_MAX);     }
+
+	private:
+	volatile unsigned *addr( void )
+	{
+		static_assert(sizeof(std::atomic<unsigned>) == sizeof(unsigned), "unexpected error!");
+		return reinterpret_cast<volatile unsigned *>(this);
+	}
+};
+
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_FUT_H
@@ -43,6 +43,15 @@
 
 typedef struct __job job_t, * const job_id;
 
+struct __jbe
+{
+	cbk_t  * fun;   // job procedure taking an argument, 0 for a plain job procedure
+	union  {
+	void   * arg;   // job procedure argument
+	fun_t  * job;   // plain job procedure
+	}        data;
+};
+
 struct __job
 {
 	obj_t    obj;   // object header
@@ -52,14 +61,14 @@ struct __job
 
 	unsigned head;  // first element to read from data buffer
 	unsigned tail;  // first element to write into data buffer
-	fun_t ** data;  // data buffer
+	jbe_t  * data;  // data buffer
 };
 
 #ifdef __cplusplus
 template<unsigned limit_>
-struct job_T { job_t job; fun_t *buf[limit_]; };
+struct job_T { job_t job; jbe_t buf[limit_]; };
 #else
-struct job_T { job_t job; fun_t *buf[]; };
+struct job_T { job_t job; jbe_t buf[]; };
 #endif
 
 #ifdef __cplusplus
@@ -100,7 +109,7 @@ extern "C" {
  ******************************************************************************/
 
 #ifndef __cplusplus
-#define               _JOB_DATA( _limit ) (fun_t *[_limit]){ 0 }
+#define               _JOB_DATA( _limit ) (jbe_t[_limit]){ { 0, { 0 } } }
 #endif
 
 /******************************************************************************
@@ -115,9 +124,9 @@ extern "C" {
  *
  ******************************************************************************/
 
-#define             OS_JOB( job, limit )                                    \
-                       struct { job_t job; fun_t *buf[limit]; } job##__wrk = \
-                       { _JOB_INIT( limit, job##__wrk.buf ), { 0 } };         \
+#define             OS_JOB( job, limit )                                         \
+                       struct { job_t job; jbe_t buf[limit]; } job##__wrk =      \
+                       { _JOB_INIT( limit, job##__wrk.buf ), { { 0, { 0 } } } }; \
                        job_id job = & job##__wrk.job
 
 /******************************************************************************
@@ -132,9 +141,9 @@ extern "C" {
  *
  ******************************************************************************/
 
-#define         static_JOB( job, limit )                                    \
-                static struct { job_t job; fun_t *buf[limit]; } job##__wrk = \
-                       { _JOB_INIT( limit, job##__wrk.buf ), { 0 } };         \
+#define         static_JOB( job, limit )                                         \
+                static struct { job_t job; jbe_t buf[limit]; } job##__wrk =      \
+                       { _JOB_INIT( limit, job##__wrk.buf ), { { 0, { 0 } } } }; \
                 static job_id job = & job##__wrk.job
 
 /******************************************************************************
@@ -188,16 +197,17 @@ extern "C" {
  *
  * Parameters
  *   job             : pointer to job queue object
- *   data            : job queue data buffer
+ *   data            : job queue data buffer (array of job queue entries)
  *   bufsize         : size of the data buffer (in bytes)
  *
  * Return            : none
  *
  * Note              : use only in thread mode
+ *                     the buffer holds bufsize / sizeof(jbe_t) jobs; a jbe_t entry takes two pointers
  *
  ******************************************************************************/
 
-void job_init( job_t *job, fun_t **data, unsigned bufsize );
+void job_init( job_t *job, jbe_t *data, unsigned bufsize );
 
 /******************************************************************************
  *
@@ -386,6 +396,112 @@ unsigned job_give( job_t *job, fun_t *fun );
 __STATIC_INLINE
 unsigned job_giveISR( job_t *job, fun_t *fun ) { return job_give(job, fun); }
 
+/******************************************************************************
+ *
+ * Name              : job_giveArg
+ * ISR alias         : job_giveArgISR
+ *
+ * Description       : try to transfer job procedure with its argument to the job queue object,
+ *                     don't wait if the job queue object is full
+ *
+ * Parameters
+ *   job             : pointer to job queue object
+ *   fun             : pointer to job procedure
+ *   arg             : argument passed to the job procedure
+ *
+ * Return
+ *   E_SUCCESS       : job data was successfully transferred to the job queue object
+ *   E_TIMEOUT       : job queue object is full, try again
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+unsigned job_giveArg( job_t *job, cbk_t *fun, void *arg );
+
+__STATIC_INLINE
+unsigned job_giveArgISR( job_t *job, cbk_t *fun, void *arg ) { return job_giveArg(job, fun, arg); }
+
+/******************************************************************************
+ *
+ * Name              : job_giveBatch
+ * ISR alias         : job_giveBatchISR
+ *
+ * Description       : try to transfer all the given job entries to the job queue object at once,
+ *                     don't wait if the job queue object has not enough free space
+ *
+ * Parameters
+ *   job             : pointer to job queue object
+ *   ent             : pointer to table of job entries
+ *                     (fun: job procedure taking data.arg or 0 for plain job procedure data.job)
+ *   count           : number of job entries
+ *
+ * Return
+ *   E_SUCCESS       : all job entries were successfully transferred to the job queue object
+ *   E_TIMEOUT       : job queue object has not enough free space, none of the entries was transferred
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+unsigned job_giveBatch( job_t *job, const jbe_t *ent, unsigned count );
+
+__STATIC_INLINE
+unsigned job_giveBatchISR( job_t *job, const jbe_t *ent, unsigned count ) { return job_giveBatch(job, ent, count); }
+
+/******************************************************************************
+ *
+ * Name              : job_giveUrgent
+ * ISR alias         : job_giveUrgentISR
+ *
+ * Description       : try to transfer job data to the head of the job queue object,
+ *                     the job will be executed before all the jobs already stored in the job queue object,
+ *                     don't wait if the job queue object is full
+ *
+ * Parameters
+ *   job             : pointer to job queue object
+ *   fun             : pointer to job procedure
+ *
+ * Return
+ *   E_SUCCESS       : job data was successfully transferred to the job queue object
+ *   E_TIMEOUT       : job queue object is full, try again
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+unsigned job_giveUrgent( job_t *job, fun_t *fun );
+
+__STATIC_INLINE
+unsigned job_giveUrgentISR( job_t *job, fun_t *fun ) { return job_giveUrgent(job, fun); }
+
+/******************************************************************************
+ *
+ * Name              : job_giveUrgentArg
+ * ISR alias         : job_giveUrgentArgISR
+ *
+ * Description       : try to transfer job procedure with its argument to the head of the job queue object,
+ *                     the job will be executed before all the jobs already stored in the job queue object,
+ *                     don't wait if the job queue object is full
+ *
+ * Parameters
+ *   job             : pointer to job queue object
+ *   fun             : pointer to job procedure
+ *   arg             : argument passed to the job procedure
+ *
+ * Return
+ *   E_SUCCESS       : job data was successfully transferred to the job queue object
+ *   E_TIMEOUT       : job queue object is full, try again
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+unsigned job_giveUrgentArg( job_t *job, cbk_t *fun, void *arg );
+
+__STATIC_INLINE
+unsigned job_giveUrgentArgISR( job_t *job, cbk_t *fun, void *arg ) { return job_giveUrgentArg(job, fun, arg); }
+
 /******************************************************************************
  *
  * Name              : job_sendFor
@@ -412,6 +528,33 @@ unsigned job_giveISR( job_t *job, fun_t *fun ) { return job_give(job, fun); }
 
 unsigned job_sendFor( job_t *job, fun_t *fun, cnt_t delay );
 
+/******************************************************************************
+ *
+ * Name              : job_sendForArg
+ *
+ * Description       : try to transfer job procedure with its argument to the job queue object,
+ *                     wait for given duration of time while the job queue object is full
+ *
+ * Parameters
+ *   job             : pointer to job queue object
+ *   fun             : pointer to job procedure
+ *   arg             : argument passed to the job procedure
+ *   delay           : duration of time (maximum number of ticks to wait while the job queue object is full)
+ *                     IMMEDIATE: don't wait if the job queue object is full
+ *                     INFINITE:  wait indefinitely while the job queue object is full
+ *
+ * Return
+ *   E_SUCCESS       : job data was successfully transferred to the job queue object
+ *   E_STOPPED       : job queue object was reseted before the specified timeout expired
+ *   E_DELETED       : job queue object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : job queue object is full and was not issued data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned job_sendForArg( job_t *job, cbk_t *fun, void *arg, cnt_t delay );
+
 /******************************************************************************
  *
  * Name              : job_sendUntil
@@ -436,6 +579,31 @@ unsigned job_sendFor( job_t *job, fun_t *fun, cnt_t delay );
 
 unsigned job_sendUntil( job_t *job, fun_t *fun, cnt_t time );
 
+/******************************************************************************
+ *
+ * Name              : job_sendUntilArg
+ *
+ * Description       : try to transfer job procedure with its argument to the job queue object,
+ *                     wait until given timepoint while the job queue object is full
+ *
+ * Parameters
+ *   job             : pointer to job queue object
+ *   fun             : pointer to job procedure
+ *   arg             : argument passed to the job procedure
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : job data was successfully transferred to the job queue object
+ *   E_STOPPED       : job queue object was reseted before the specified timeout expired
+ *   E_DELETED       : job queue object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : job queue object is full and was not issued data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned job_sendUntilArg( job_t *job, cbk_t *fun, void *arg, cnt_t time );
+
 /******************************************************************************
  *
  * Name              : job_send
@@ -459,6 +627,30 @@ unsigned job_sendUntil( job_t *job, fun_t *fun, cnt_t time );
 __STATIC_INLINE
 unsigned job_send( job_t *job, fun_t *fun ) { return job_sendFor(job, fun, INFINITE); }
 
+/******************************************************************************
+ *
+ * Name              : job_sendArg
+ *
+ * Description       : try to transfer job procedure with its argument to the job queue object,
+ *                     wait indefinitely while the job queue object is full
+ *
+ * Parameters
+ *   job             : pointer to job queue object
+ *   fun             : pointer to job procedure
+ *   arg             : argument passed to the job procedure
+ *
+ * Return
+ *   E_SUCCESS       : job data was successfully transferred to the job queue object
+ *   E_STOPPED       : job queue object was reseted
+ *   E_DELETED       : job queue object was deleted
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+unsigned job_sendArg( job_t *job, cbk_t *fun, void *arg ) { return job_sendForArg(job, fun, arg, INFINITE); }
+
 /******************************************************************************
  *
  * Name              : job_push
@@ -482,6 +674,68 @@ void job_push( job_t *job, fun_t *fun );
 __STATIC_INLINE
 void job_pushISR( job_t *job, fun_t *fun ) { job_push(job, fun); }
 
+/******************************************************************************
+ *
+ * Name              : job_pushArg
+ * ISR alias         : job_pushArgISR
+ *
+ * Description       : try to transfer job procedure with its argument to the job queue object,
+ *                     remove the oldest job data if the job queue object is full
+ *
+ * Parameters
+ *   job             : pointer to job queue object
+ *   fun             : pointer to job procedure
+ *   arg             : argument passed to the job procedure
+ *
+ * Return            : none
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+void job_pushArg( job_t *job, cbk_t *fun, void *arg );
+
+__STATIC_INLINE
+void job_pushArgISR( job_t *job, cbk_t *fun, void *arg ) { job_pushArg(job, fun, arg); }
+
+/******************************************************************************
+ *
+ * Name              : job_count
+ * ISR alias         : job_countISR
+ *
+ * Description       : return the amount of data contained in the job queue
+ *
+ * Parameters
+ *   job             : pointer to job queue object
+ *
+ * Return            : amount of data contained in the job queue
+ *
+ ******************************************************************************/
+
+unsigned job_count( job_t *job );
+
+__STATIC_INLINE
+unsigned job_countISR( job_t *job ) { return job_count(job); }
+
+/******************************************************************************
+ *
+ * Name              : job_space
+ * ISR alias         : job_spaceISR
+ *
+ * Description       : return the amount of free space in the job queue
+ *
+ * Parameters
+ *   job             : pointer to job queue object
+ *
+ * Return            : amount of free space in the job queue
+ *
+ ******************************************************************************/
+
+unsigned job_space( job_t *job );
+
+__STATIC_INLINE
+unsigned job_spaceISR( job_t *job ) { return job_space(job); }
+
 #ifdef __cplusplus
 }
 #endif
@@ -539,6 +793,14 @@ struct JobQueueT : public __box
 	unsigned limit    ( void )                     {             unsigned limit = box_limit    (this);                                                return limit; }
 	unsigned limitISR ( void )                     {             unsigned limit = box_limitISR (this);                                                return limit; }
 
+	unsigned giveArg     ( cbk_t *_fun, void *_arg )               { FUN_t _job = [=]{ _fun(_arg); }; return box_give     (this, &_job);         }
+	unsigned giveArgISR  ( cbk_t *_fun, void *_arg )               { FUN_t _job = [=]{ _fun(_arg); }; return box_giveISR  (this, &_job);         }
+	unsigned sendForArg  ( cbk_t *_fun, void *_arg, cnt_t _delay ) { FUN_t _job = [=]{ _fun(_arg); }; return box_sendFor  (this, &_job, _delay); }
+	unsigned sendUntilArg( cbk_t *_fun, void *_arg, cnt_t _time )  { FUN_t _job = [=]{ _fun(_arg); }; return box_sendUntil(this, &_job, _time);  }
+	unsigned sendArg     ( cbk_t *_fun, void *_arg )               { FUN_t _job = [=]{ _fun(_arg); }; return box_send     (this, &_job);         }
+	void     pushArg     ( cbk_t *_fun, void *_arg )               { FUN_t _job = [=]{ _fun(_arg); };        box_push     (this, &_job);         }
+	void     pushArgISR  ( cbk_t *_fun, void *_arg )               { FUN_t _job = [=]{ _fun(_arg); };        box_pushISR  (this, &_job);         }
+
 	private:
 	FUN_t data_[limit_];
 };
@@ -581,8 +843,16 @@ struct JobQueueT : public __job
 	unsigned limit    ( void )                     { return job_limit    (this);               }
 	unsigned limitISR ( void )                     { return job_limitISR (this);               }
 
+	unsigned giveArg     ( cbk_t *_fun, void *_arg )               { return job_giveArg     (this, _fun, _arg);         }
+	unsigned giveArgISR  ( cbk_t *_fun, void *_arg )               { return job_giveArgISR  (this, _fun, _arg);         }
+	unsigned sendForArg  ( cbk_t *_fun, void *_arg, cnt_t _delay ) { return job_sendForArg  (this, _fun, _arg, _delay); }
+	unsigned sendUntilArg( cbk_t *_fun, void *_arg, cnt_t _time )  { return job_sendUntilArg(this, _fun, _arg, _time);  }
+	unsigned sendArg     ( cbk_t *_fun, void *_arg )               { return job_sendArg     (this, _fun, _arg);         }
+	void     pushArg     ( cbk_t *_fun, void *_arg )               {        job_pushArg     (this, _fun, _arg);         }
+	void     pushArgISR  ( cbk_t *_fun, void *_arg )               {        job_pushArgISR  (this, _fun, _arg);         }
+
 	private:
-	FUN_t data_[limit_];
+	jbe_t data_[limit_];
 };
 
 #endif
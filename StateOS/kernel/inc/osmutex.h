@@ -47,6 +47,7 @@
 #define mtxPrioNone      0U // none
 #define mtxPrioInherit   4U // priority inheritance mutex
 #define mtxPrioProtect   8U // priority protected mutex (OCPP)
+#define mtxPrioCeiling  12U // immediate priority ceiling mutex (ICPP / SRP); owner runs at the mutex priority
 #define mtxPrioMASK   ( mtxPrioNone | mtxPrioInherit | mtxPrioProtect )
 
 /////// mutex robustness
@@ -56,7 +57,11 @@
 /////// inconsistency of robust mutex
 #define mtxInconsistent 32U // inconsistent mutex
 
-#define mtxMASK       ( mtxTypeMASK + mtxPrioMASK + mtxRobust + mtxInconsistent )
+/////// mutex handoff
+#define mtxHandoff       0U // unlocked mutex is passed directly to the first waiting task
+#define mtxBarging      64U // unlocked mutex is released and the first waiting task competes for it (throughput mode)
+
+#define mtxMASK       ( mtxTypeMASK + mtxPrioMASK + mtxRobust + mtxInconsistent + mtxBarging )
 
 /* -------------------------------------------------------------------------- */
 
@@ -74,10 +79,11 @@ struct __mtx
 	obj_t    obj;   // object header
 
 	tsk_t  * owner; // mutex owner
-	unsigned mode;  // mutex mode: mutex type + mutex protocol + mutex robustness
+	unsigned mode;  // mutex mode: mutex type + mutex protocol + mutex robustness + mutex handoff
 	unsigned count; // current value of the mutex counter
-	unsigned prio;  // mutex priority; unused if mtxPrioProtect protocol is not set
-	mtx_t  * list;  // list of mutexes held by owner
+	unsigned prio;  // mutex priority; unused if mtxPrioProtect or mtxPrioCeiling protocol is not set
+	mtx_t  * list;  // next object in the list of mutexes held by owner (ordered by inherited priority)
+	mtx_t ** back;  // previous object in the list of mutexes held by owner
 };
 
 #ifdef __cplusplus
@@ -91,11 +97,12 @@ extern "C" {
  * Description       : create and initialize a mutex object
  *
  * Parameters
- *   mode            : mutex mode (mutex type + mutex protocol + mutex robustness)
+ *   mode            : mutex mode (mutex type + mutex protocol + mutex robustness + mutex handoff)
  *                           type: mtxNormal or mtxErrorCheck or mtxRecursive
- *                       protocol: mtxPrioNone or mtxPrioInherit or mtxPrioProtect
+ *                       protocol: mtxPrioNone or mtxPrioInherit or mtxPrioProtect or mtxPrioCeiling
  *                     robustness: mtxStalled or mtxRobust
- *   prio            : mutex priority; unused if mtxPrioProtect protocol is not set
+ *                        handoff: mtxHandoff or mtxBarging
+ *   prio            : mutex priority; unused if mtxPrioProtect or mtxPrioCeiling protocol is not set
  *
  * Return            : mutex object
  *
@@ -103,7 +110,7 @@ extern "C" {
  *
  ******************************************************************************/
 
-#define               _MTX_INIT( _mode, _prio ) { _OBJ_INIT(), 0, _mode, 0, _prio, 0 }
+#define               _MTX_INIT( _mode, _prio ) { _OBJ_INIT(), 0, _mode, 0, _prio, 0, 0 }
 
 /******************************************************************************
  *
@@ -126,11 +133,12 @@ extern "C" {
  *
  * Parameters
  *   mtx             : name of a pointer to mutex object
- *   mode            : mutex mode (mutex type + mutex protocol + mutex robustness)
+ *   mode            : mutex mode (mutex type + mutex protocol + mutex robustness + mutex handoff)
  *                           type: mtxNormal or mtxErrorCheck or mtxRecursive
- *                       protocol: mtxPrioNone or mtxPrioInherit or mtxPrioProtect
+ *                       protocol: mtxPrioNone or mtxPrioInherit or mtxPrioProtect or mtxPrioCeiling
  *                     robustness: mtxStalled or mtxRobust
- *   prio            : mutex priority; unused if mtxPrioProtect protocol is not set
+ *                        handoff: mtxHandoff or mtxBarging
+ *   prio            : mutex priority; unused if mtxPrioProtect or mtxPrioCeiling protocol is not set
  *
  ******************************************************************************/
 
@@ -146,11 +154,12 @@ extern "C" {
  *
  * Parameters
  *   mtx             : name of a pointer to mutex object
- *   mode            : mutex mode (mutex type + mutex protocol + mutex robustness)
+ *   mode            : mutex mode (mutex type + mutex protocol + mutex robustness + mutex handoff)
  *                           type: mtxNormal or mtxErrorCheck or mtxRecursive
- *                       protocol: mtxPrioNone or mtxPrioInherit or mtxPrioProtect
+ *                       protocol: mtxPrioNone or mtxPrioInherit or mtxPrioProtect or mtxPrioCeiling
  *                     robustness: mtxStalled or mtxRobust
- *   prio            : mutex priority; unused if mtxPrioProtect protocol is not set
+ *                        handoff: mtxHandoff or mtxBarging
+ *   prio            : mutex priority; unused if mtxPrioProtect or mtxPrioCeiling protocol is not set
  *
  ******************************************************************************/
 
@@ -165,11 +174,12 @@ extern "C" {
  * Description       : create and initialize a mutex object
  *
  * Parameters
- *   mode            : mutex mode (mutex type + mutex protocol + mutex robustness)
+ *   mode            : mutex mode (mutex type + mutex protocol + mutex robustness + mutex handoff)
  *                           type: mtxNormal or mtxErrorCheck or mtxRecursive
- *                       protocol: mtxPrioNone or mtxPrioInherit or mtxPrioProtect
+ *                       protocol: mtxPrioNone or mtxPrioInherit or mtxPrioProtect or mtxPrioCeiling
  *                     robustness: mtxStalled or mtxRobust
- *   prio            : mutex priority; unused if mtxPrioProtect protocol is not set
+ *                        handoff: mtxHandoff or mtxBarging
+ *   prio            : mutex priority; unused if mtxPrioProtect or mtxPrioCeiling protocol is not set
  *
  * Return            : mutex object
  *
@@ -190,11 +200,12 @@ extern "C" {
  * Description       : create and initialize a mutex object
  *
  * Parameters
- *   mode            : mutex mode (mutex type + mutex protocol + mutex robustness)
+ *   mode            : mutex mode (mutex type + mutex protocol + mutex robustness + mutex handoff)
  *                           type: mtxNormal or mtxErrorCheck or mtxRecursive
- *                       protocol: mtxPrioNone or mtxPrioInherit or mtxPrioProtect
+ *                       protocol: mtxPrioNone or mtxPrioInherit or mtxPrioProtect or mtxPrioCeiling
  *                     robustness: mtxStalled or mtxRobust
- *   prio            : mutex priority; unused if mtxPrioProtect protocol is not set
+ *                        handoff: mtxHandoff or mtxBarging
+ *   prio            : mutex priority; unused if mtxPrioProtect or mtxPrioCeiling protocol is not set
  *
  * Return            : pointer to mutex object
  *
@@ -217,11 +228,12 @@ extern "C" {
  *
  * Parameters
  *   mtx             : pointer to mutex object
- *   mode            : mutex mode (mutex type + mutex protocol + mutex robustness)
+ *   mode            : mutex mode (mutex type + mutex protocol + mutex robustness + mutex handoff)
  *                           type: mtxNormal or mtxErrorCheck or mtxRecursive
- *                       protocol: mtxPrioNone or mtxPrioInherit or mtxPrioProtect
+ *                       protocol: mtxPrioNone or mtxPrioInherit or mtxPrioProtect or mtxPrioCeiling
  *                     robustness: mtxStalled or mtxRobust
- *   prio            : mutex priority; unused if mtxPrioProtect protocol is not set
+ *                        handoff: mtxHandoff or mtxBarging
+ *   prio            : mutex priority; unused if mtxPrioProtect or mtxPrioCeiling protocol is not set
  *
  * Return            : none
  *
@@ -239,11 +251,12 @@ void mtx_init( mtx_t *mtx, unsigned mode, unsigned prio );
  * Description       : create and initialize a new mutex object
  *
  * Parameters
- *   mode            : mutex mode (mutex type + mutex protocol + mutex robustness)
+ *   mode            : mutex mode (mutex type + mutex protocol + mutex robustness + mutex handoff)
  *                           type: mtxNormal or mtxErrorCheck or mtxRecursive
- *                       protocol: mtxPrioNone or mtxPrioInherit or mtxPrioProtect
+ *                       protocol: mtxPrioNone or mtxPrioInherit or mtxPrioProtect or mtxPrioCeiling
  *                     robustness: mtxStalled or mtxRobust
- *   prio            : mutex priority; unused if mtxPrioProtect protocol is not set
+ *                        handoff: mtxHandoff or mtxBarging
+ *   prio            : mutex priority; unused if mtxPrioProtect or mtxPrioCeiling protocol is not set
  *
  * Return            : pointer to mutex object (mutex successfully created)
  *   0               : mutex not created (not enough free memory)
@@ -356,6 +369,9 @@ unsigned mtx_getPrio( mtx_t *mtx );
  *   E_TIMEOUT       : mutex object can't be locked immediately, try again
  *
  * Note              : use only in thread mode
+ *                     mutex with mtxPrioCeiling protocol raises the priority of the owner to the mutex priority in O(1)
+ *                     so no task that uses the mutex can preempt the owner; such a mutex is never waited for
+ *                     if the owner doesn't block, and it can be used by basic tasks sharing one stack
  *
  ******************************************************************************/
 
@@ -460,6 +476,8 @@ unsigned mtx_lock( mtx_t *mtx ) { return mtx_wait(mtx); }
  *   E_FAILURE       : mutex object can't be unlocked
  *
  * Note              : use only in thread mode
+ *                     mutex with mtxBarging handoff is released and the first waiting task is resumed to compete for it,
+ *                     so the unlocking task can lock it again without a context switch
  *
  ******************************************************************************/
 
@@ -483,11 +501,12 @@ unsigned mtx_unlock( mtx_t *mtx ) { return mtx_give(mtx); }
  * Description       : create and initialize a mutex object
  *
  * Constructor parameters
- *   mode            : mutex mode (mutex type + mutex protocol + mutex robustness)
+ *   mode            : mutex mode (mutex type + mutex protocol + mutex robustness + mutex handoff)
  *                           type: mtxNormal or mtxErrorCheck or mtxRecursive
- *                       protocol: mtxPrioNone or mtxPrioInherit or mtxPrioProtect
+ *                       protocol: mtxPrioNone or mtxPrioInherit or mtxPrioProtect or mtxPrioCeiling
  *                     robustness: mtxStalled or mtxRobust
- *   prio            : mutex priority; unused if mtxPrioProtect protocol is not set
+ *                        handoff: mtxHandoff or mtxBarging
+ *   prio            : mutex priority; unused if mtxPrioProtect or mtxPrioCeiling protocol is not set
  *
  ******************************************************************************/
 
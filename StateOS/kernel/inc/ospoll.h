@@ -0,0 +1,207 @@
+/******************************************************************************
+
+    @file    StateOS: ospoll.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#ifndef __STATEOS_POL_H
+#define __STATEOS_POL_H
+
+#include "oskernel.h"
+
+/* -------------------------------------------------------------------------- */
+
+#define polSemaphore     1      // poller of semaphore object
+#define polFlag          2      // poller of flag object
+#define polStreamBuffer  3      // poller of stream buffer object
+#define polMessageBuffer 4      // poller of message buffer object
+#define polMailBoxQueue  5      // poller of mailbox queue object
+#define polEventQueue    6      // poller of event queue object
+#define polTimer         7      // poller of timer object
+
+/******************************************************************************
+ *
+ * Name              : poller
+ *                     like an element of POSIX poll array
+ *
+ ******************************************************************************/
+
+struct __pol
+{
+	void   * obj;   // polled object
+	unsigned type;  // type of polled object
+	unsigned flags; // awaited flags (used only for flag object)
+
+	tsk_t  * owner; // polling task
+	pol_t  * next;  // next poller registered on the polled object
+	pol_t ** back;  // previous poller registered on the polled object
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _POL_INIT
+ *
+ * Description       : create and initialize a poller object
+ *
+ * Parameters
+ *   obj             : pointer to polled object
+ *   type            : type of polled object
+ *   flags           : awaited flags (used only for flag object)
+ *
+ * Return            : poller object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _POL_INIT( _obj, _type, _flags ) { _obj, _type, _flags, 0, 0, 0 }
+
+/******************************************************************************
+ *
+ * Name              : POL_SEM
+ *                     POL_FLG
+ *                     POL_STM
+ *                     POL_MSG
+ *                     POL_BOX
+ *                     POL_EVQ
+ *                     POL_TMR
+ *
+ * Description       : create and initialize a poller of the given kernel object
+ *                     poller is ready if the corresponding 'take' function would succeed:
+ *                     semaphore counter is not zero,
+ *                     any of awaited flags is set,
+ *                     stream buffer / message buffer / mailbox queue / event queue is not empty,
+ *                     timer has finished countdown
+ *
+ * Parameters
+ *   sem             : pointer to semaphore object
+ *   flg             : pointer to flag object
+ *   flags           : awaited flags
+ *   stm             : pointer to stream buffer object
+ *   msg             : pointer to message buffer object
+ *   box             : pointer to mailbox queue object
+ *   evq             : pointer to event queue object
+ *   tmr             : pointer to timer object
+ *
+ * Return            : poller object, used as an element of the list passed to sys_waitAny
+ *
+ ******************************************************************************/
+
+#define                POL_SEM( sem )        _POL_INIT( sem, polSemaphore,     0     )
+#define                POL_FLG( flg, flags ) _POL_INIT( flg, polFlag,          flags )
+#define                POL_STM( stm )        _POL_INIT( stm, polStreamBuffer,  0     )
+#define                POL_MSG( msg )        _POL_INIT( msg, polMessageBuffer, 0     )
+#define                POL_BOX( box )        _POL_INIT( box, polMailBoxQueue,  0     )
+#define                POL_EVQ( evq )        _POL_INIT( evq, polEventQueue,    0     )
+#define                POL_TMR( tmr )        _POL_INIT( tmr, polTimer,         0     )
+
+/******************************************************************************
+ *
+ * Name              : sys_takeAny
+ * ISR alias         : sys_takeAnyISR
+ *
+ * Description       : check if any of the polled objects is ready, don't wait
+ *                     the polled object is not taken
+ *
+ * Parameters
+ *   list            : array of pollers
+ *   count           : number of pollers in the array
+ *
+ * Return
+ *   index           : index of the first ready poller in the array
+ *   E_TIMEOUT       : none of the polled objects is ready, try again
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+unsigned sys_takeAny( pol_t *list, unsigned count );
+
+__STATIC_INLINE
+unsigned sys_takeAnyISR( pol_t *list, unsigned count ) { return sys_takeAny(list, count); }
+
+/******************************************************************************
+ *
+ * Name              : sys_waitAny
+ *
+ * Description       : wait for given duration of time until any of the polled objects is ready
+ *                     the polled object is not taken; use the corresponding 'take' function afterwards
+ *                     only the tasks registered on the object are notified, when the object becomes ready
+ *
+ * Parameters
+ *   list            : array of pollers
+ *   count           : number of pollers in the array
+ *   delay           : duration of time (maximum number of ticks to wait for any of the polled objects)
+ *                     IMMEDIATE: don't wait if none of the polled objects is ready
+ *                     INFINITE:  wait indefinitely until any of the polled objects is ready
+ *
+ * Return
+ *   index           : index of the poller in the array, whose object is ready, reseted or deleted
+ *   E_TIMEOUT       : none of the polled objects became ready before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned sys_waitAny( pol_t *list, unsigned count, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : sys_waitAnyUntil
+ *
+ * Description       : wait until given timepoint until any of the polled objects is ready
+ *                     the polled object is not taken; use the corresponding 'take' function afterwards
+ *                     only the tasks registered on the object are notified, when the object becomes ready
+ *
+ * Parameters
+ *   list            : array of pollers
+ *   count           : number of pollers in the array
+ *   time            : timepoint value
+ *
+ * Return
+ *   index           : index of the poller in the array, whose object is ready, reseted or deleted
+ *   E_TIMEOUT       : none of the polled objects became ready before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned sys_waitAnyUntil( pol_t *list, unsigned count, cnt_t time );
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_POL_H
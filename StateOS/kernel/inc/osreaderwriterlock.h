@@ -0,0 +1,587 @@
+/******************************************************************************
+
+    @file    StateOS: osreaderwriterlock.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#ifndef __STATEOS_RWL_H
+#define __STATEOS_RWL_H
+
+#include "oskernel.h"
+
+/* -------------------------------------------------------------------------- */
+
+/////// reader-writer lock policy
+#define rwlReaderPref    0U // readers are preferred
+#define rwlWriterPref    1U // writers are preferred
+#define rwlPrefMASK   ( rwlReaderPref | rwlWriterPref )
+
+/////// reader-writer lock protocol
+#define rwlPrioNone      0U // none
+#define rwlPrioInherit   2U // priority inheritance toward the writer
+#define rwlPrioMASK   ( rwlPrioNone | rwlPrioInherit )
+
+#define rwlDefault      rwlReaderPref
+#define rwlMASK       ( rwlPrefMASK + rwlPrioMASK )
+
+/******************************************************************************
+ *
+ * Name              : reader-writer lock
+ *                     like a POSIX pthread_rwlock_t
+ *
+ ******************************************************************************/
+
+struct __rwl
+{
+	obj_t    obj;   // object header; queue of tasks waiting for exclusive access
+
+	tsk_t  * owner; // writer owning the lock
+	unsigned mode;  // lock mode: lock policy + lock protocol
+	unsigned count; // number of readers owning the lock
+	tsk_t  * queue; // queue of tasks waiting for shared access
+	rwl_t  * list;  // next object in the list of reader-writer locks held by owner
+	rwl_t ** back;  // previous object in the list of reader-writer locks held by owner
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _RWL_INIT
+ *
+ * Description       : create and initialize a reader-writer lock object
+ *
+ * Parameters
+ *   mode            : lock mode (lock policy + lock protocol)
+ *                       policy: rwlReaderPref or rwlWriterPref
+ *                     protocol: rwlPrioNone or rwlPrioInherit
+ *
+ * Return            : reader-writer lock object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _RWL_INIT( _mode ) { _OBJ_INIT(), 0, _mode, 0, 0, 0, 0 }
+
+/******************************************************************************
+ *
+ * Name              : OS_RWL
+ *
+ * Description       : define and initialize a reader-writer lock object
+ *
+ * Parameters
+ *   rwl             : name of a pointer to reader-writer lock object
+ *   mode            : lock mode (lock policy + lock protocol)
+ *                       policy: rwlReaderPref or rwlWriterPref
+ *                     protocol: rwlPrioNone or rwlPrioInherit
+ *
+ ******************************************************************************/
+
+#define             OS_RWL( rwl, mode )                     \
+                       rwl_t rwl##__rwl = _RWL_INIT( mode ); \
+                       rwl_id rwl = & rwl##__rwl
+
+/******************************************************************************
+ *
+ * Name              : static_RWL
+ *
+ * Description       : define and initialize a static reader-writer lock object
+ *
+ * Parameters
+ *   rwl             : name of a pointer to reader-writer lock object
+ *   mode            : lock mode (lock policy + lock protocol)
+ *                       policy: rwlReaderPref or rwlWriterPref
+ *                     protocol: rwlPrioNone or rwlPrioInherit
+ *
+ ******************************************************************************/
+
+#define         static_RWL( rwl, mode )                     \
+                static rwl_t rwl##__rwl = _RWL_INIT( mode ); \
+                static rwl_id rwl = & rwl##__rwl
+
+/******************************************************************************
+ *
+ * Name              : RWL_INIT
+ *
+ * Description       : create and initialize a reader-writer lock object
+ *
+ * Parameters
+ *   mode            : lock mode (lock policy + lock protocol)
+ *                       policy: rwlReaderPref or rwlWriterPref
+ *                     protocol: rwlPrioNone or rwlPrioInherit
+ *
+ * Return            : reader-writer lock object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                RWL_INIT( mode ) \
+                      _RWL_INIT( mode )
+#endif
+
+/******************************************************************************
+ *
+ * Name              : RWL_CREATE
+ * Alias             : RWL_NEW
+ *
+ * Description       : create and initialize a reader-writer lock object
+ *
+ * Parameters
+ *   mode            : lock mode (lock policy + lock protocol)
+ *                       policy: rwlReaderPref or rwlWriterPref
+ *                     protocol: rwlPrioNone or rwlPrioInherit
+ *
+ * Return            : pointer to reader-writer lock object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                RWL_CREATE( mode ) \
+           (rwl_t[]) { RWL_INIT  ( mode ) }
+#define                RWL_NEW \
+                       RWL_CREATE
+#endif
+
+/******************************************************************************
+ *
+ * Name              : rwl_init
+ *
+ * Description       : initialize a reader-writer lock object
+ *
+ * Parameters
+ *   rwl             : pointer to reader-writer lock object
+ *   mode            : lock mode (lock policy + lock protocol)
+ *                       policy: rwlReaderPref or rwlWriterPref
+ *                     protocol: rwlPrioNone or rwlPrioInherit
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void rwl_init( rwl_t *rwl, unsigned mode );
+
+/******************************************************************************
+ *
+ * Name              : rwl_create
+ * Alias             : rwl_new
+ *
+ * Description       : create and initialize a new reader-writer lock object
+ *
+ * Parameters
+ *   mode            : lock mode (lock policy + lock protocol)
+ *                       policy: rwlReaderPref or rwlWriterPref
+ *                     protocol: rwlPrioNone or rwlPrioInherit
+ *
+ * Return            : pointer to reader-writer lock object (reader-writer lock successfully created)
+ *   0               : reader-writer lock not created (not enough free memory)
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+rwl_t *rwl_create( unsigned mode );
+
+__STATIC_INLINE
+rwl_t *rwl_new( unsigned mode ) { return rwl_create(mode); }
+
+/******************************************************************************
+ *
+ * Name              : rwl_reset
+ * Alias             : rwl_kill
+ *
+ * Description       : reset the reader-writer lock object and wake up all waiting tasks with 'E_STOPPED' event value
+ *
+ * Parameters
+ *   rwl             : pointer to reader-writer lock object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void rwl_reset( rwl_t *rwl );
+
+__STATIC_INLINE
+void rwl_kill( rwl_t *rwl ) { rwl_reset(rwl); }
+
+/******************************************************************************
+ *
+ * Name              : rwl_destroy
+ * Alias             : rwl_delete
+ *
+ * Description       : reset the reader-writer lock object, wake up all waiting tasks with 'E_DELETED' event value and free allocated resource
+ *
+ * Parameters
+ *   rwl             : pointer to reader-writer lock object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void rwl_destroy( rwl_t *rwl );
+
+__STATIC_INLINE
+void rwl_delete( rwl_t *rwl ) { rwl_destroy(rwl); }
+
+/******************************************************************************
+ *
+ * Name              : rwl_takeRead
+ * Alias             : rwl_tryLockRead
+ * ISR alias         : rwl_takeReadISR
+ *
+ * Description       : try to lock the reader-writer lock object for shared access,
+ *                     don't wait if the reader-writer lock object can't be locked immediately
+ *
+ * Parameters
+ *   rwl             : pointer to reader-writer lock object
+ *
+ * Return
+ *   E_SUCCESS       : reader-writer lock object was successfully locked for shared access
+ *   E_TIMEOUT       : reader-writer lock object can't be locked immediately, try again
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+unsigned rwl_takeRead( rwl_t *rwl );
+
+__STATIC_INLINE
+unsigned rwl_tryLockRead( rwl_t *rwl ) { return rwl_takeRead(rwl); }
+
+__STATIC_INLINE
+unsigned rwl_takeReadISR( rwl_t *rwl ) { return rwl_takeRead(rwl); }
+
+/******************************************************************************
+ *
+ * Name              : rwl_waitReadFor
+ *
+ * Description       : try to lock the reader-writer lock object for shared access,
+ *                     wait for given duration of time if the reader-writer lock object can't be locked immediately
+ *
+ * Parameters
+ *   rwl             : pointer to reader-writer lock object
+ *   delay           : duration of time (maximum number of ticks to wait for lock the reader-writer lock object)
+ *                     IMMEDIATE: don't wait if the reader-writer lock object can't be locked immediately
+ *                     INFINITE:  wait indefinitely until the reader-writer lock object has been locked
+ *
+ * Return
+ *   E_SUCCESS       : reader-writer lock object was successfully locked for shared access
+ *   E_STOPPED       : reader-writer lock object was reseted before the specified timeout expired
+ *   E_DELETED       : reader-writer lock object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : reader-writer lock object was not locked before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned rwl_waitReadFor( rwl_t *rwl, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : rwl_waitReadUntil
+ *
+ * Description       : try to lock the reader-writer lock object for shared access,
+ *                     wait until given timepoint if the reader-writer lock object can't be locked immediately
+ *
+ * Parameters
+ *   rwl             : pointer to reader-writer lock object
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : reader-writer lock object was successfully locked for shared access
+ *   E_STOPPED       : reader-writer lock object was reseted before the specified timeout expired
+ *   E_DELETED       : reader-writer lock object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : reader-writer lock object was not locked before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned rwl_waitReadUntil( rwl_t *rwl, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : rwl_waitRead
+ * Alias             : rwl_lockRead
+ *
+ * Description       : try to lock the reader-writer lock object for shared access,
+ *                     wait indefinitely if the reader-writer lock object can't be locked immediately
+ *
+ * Parameters
+ *   rwl             : pointer to reader-writer lock object
+ *
+ * Return
+ *   E_SUCCESS       : reader-writer lock object was successfully locked for shared access
+ *   E_STOPPED       : reader-writer lock object was reseted
+ *   E_DELETED       : reader-writer lock object was deleted
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+unsigned rwl_waitRead( rwl_t *rwl ) { return rwl_waitReadFor(rwl, INFINITE); }
+
+__STATIC_INLINE
+unsigned rwl_lockRead( rwl_t *rwl ) { return rwl_waitRead(rwl); }
+
+/******************************************************************************
+ *
+ * Name              : rwl_giveRead
+ * Alias             : rwl_unlockRead
+ * ISR alias         : rwl_giveReadISR
+ *
+ * Description       : release the shared access to the reader-writer lock object
+ *
+ * Parameters
+ *   rwl             : pointer to reader-writer lock object
+ *
+ * Return
+ *   E_SUCCESS       : reader-writer lock object was successfully unlocked
+ *   E_FAILURE       : reader-writer lock object was not locked for shared access
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+unsigned rwl_giveRead( rwl_t *rwl );
+
+__STATIC_INLINE
+unsigned rwl_unlockRead( rwl_t *rwl ) { return rwl_giveRead(rwl); }
+
+__STATIC_INLINE
+unsigned rwl_giveReadISR( rwl_t *rwl ) { return rwl_giveRead(rwl); }
+
+/******************************************************************************
+ *
+ * Name              : rwl_takeWrite
+ * Alias             : rwl_tryLockWrite
+ *
+ * Description       : try to lock the reader-writer lock object for exclusive access,
+ *                     don't wait if the reader-writer lock object can't be locked immediately
+ *
+ * Parameters
+ *   rwl             : pointer to reader-writer lock object
+ *
+ * Return
+ *   E_SUCCESS       : reader-writer lock object was successfully locked for exclusive access
+ *   E_FAILURE       : reader-writer lock object is already locked by the current task
+ *   E_TIMEOUT       : reader-writer lock object can't be locked immediately, try again
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned rwl_takeWrite( rwl_t *rwl );
+
+__STATIC_INLINE
+unsigned rwl_tryLockWrite( rwl_t *rwl ) { return rwl_takeWrite(rwl); }
+
+/******************************************************************************
+ *
+ * Name              : rwl_waitWriteFor
+ *
+ * Description       : try to lock the reader-writer lock object for exclusive access,
+ *                     wait for given duration of time if the reader-writer lock object can't be locked immediately
+ *
+ * Parameters
+ *   rwl             : pointer to reader-writer lock object
+ *   delay           : duration of time (maximum number of ticks to wait for lock the reader-writer lock object)
+ *                     IMMEDIATE: don't wait if the reader-writer lock object can't be locked immediately
+ *                     INFINITE:  wait indefinitely until the reader-writer lock object has been locked
+ *
+ * Return
+ *   E_SUCCESS       : reader-writer lock object was successfully locked for exclusive access
+ *   E_FAILURE       : reader-writer lock object is already locked by the current task
+ *   E_STOPPED       : reader-writer lock object was reseted before the specified timeout expired
+ *   E_DELETED       : reader-writer lock object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : reader-writer lock object was not locked before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned rwl_waitWriteFor( rwl_t *rwl, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : rwl_waitWriteUntil
+ *
+ * Description       : try to lock the reader-writer lock object for exclusive access,
+ *                     wait until given timepoint if the reader-writer lock object can't be locked immediately
+ *
+ * Parameters
+ *   rwl             : pointer to reader-writer lock object
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : reader-writer lock object was successfully locked for exclusive access
+ *   E_FAILURE       : reader-writer lock object is already locked by the current task
+ *   E_STOPPED       : reader-writer lock object was reseted before the specified timeout expired
+ *   E_DELETED       : reader-writer lock object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : reader-writer lock object was not locked before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned rwl_waitWriteUntil( rwl_t *rwl, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : rwl_waitWrite
+ * Alias             : rwl_lockWrite
+ *
+ * Description       : try to lock the reader-writer lock object for exclusive access,
+ *                     wait indefinitely if the reader-writer lock object can't be locked immediately
+ *
+ * Parameters
+ *   rwl             : pointer to reader-writer lock object
+ *
+ * Return
+ *   E_SUCCESS       : reader-writer lock object was successfully locked for exclusive access
+ *   E_FAILURE       : reader-writer lock object is already locked by the current task
+ *   E_STOPPED       : reader-writer lock object was reseted
+ *   E_DELETED       : reader-writer lock object was deleted
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+unsigned rwl_waitWrite( rwl_t *rwl ) { return rwl_waitWriteFor(rwl, INFINITE); }
+
+__STATIC_INLINE
+unsigned rwl_lockWrite( rwl_t *rwl ) { return rwl_waitWrite(rwl); }
+
+/******************************************************************************
+ *
+ * Name              : rwl_giveWrite
+ * Alias             : rwl_unlockWrite
+ *
+ * Description       : release the exclusive access to the reader-writer lock object (only owner task can unlock it)
+ *
+ * Parameters
+ *   rwl             : pointer to reader-writer lock object
+ *
+ * Return
+ *   E_SUCCESS       : reader-writer lock object was successfully unlocked
+ *   E_FAILURE       : reader-writer lock object can't be unlocked
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned rwl_giveWrite( rwl_t *rwl );
+
+__STATIC_INLINE
+unsigned rwl_unlockWrite( rwl_t *rwl ) { return rwl_giveWrite(rwl); }
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+
+/******************************************************************************
+ *
+ * Class             : ReaderWriterLock
+ *
+ * Description       : create and initialize a reader-writer lock object
+ *
+ * Constructor parameters
+ *   mode            : lock mode (lock policy + lock protocol)
+ *                       policy: rwlReaderPref or rwlWriterPref
+ *                     protocol: rwlPrioNone or rwlPrioInherit
+ *
+ * Note              : satisfies the SharedMutex requirements,
+ *                     may be used with std::unique_lock and std::shared_lock
+ *
+ ******************************************************************************/
+
+struct ReaderWriterLock : public __rwl
+{
+	 ReaderWriterLock( const unsigned _mode = rwlDefault ): __rwl _RWL_INIT(_mode) {}
+	~ReaderWriterLock( void ) { assert(__rwl::owner == nullptr && __rwl::count == 0); }
+
+	static
+	ReaderWriterLock *create( const unsigned _mode = rwlDefault )
+	{
+		static_assert(sizeof(__rwl) == sizeof(ReaderWriterLock), "unexpected error!");
+		return reinterpret_cast<ReaderWriterLock *>(rwl_create(_mode));
+	}
+
+	void     reset          ( void )         {        rwl_reset         (this);              }
+	void     kill           ( void )         {        rwl_kill          (this);              }
+	void     destroy        ( void )         {        rwl_destroy       (this);              }
+	unsigned takeRead       ( void )         { return rwl_takeRead      (this);              }
+	unsigned tryLockRead    ( void )         { return rwl_tryLockRead   (this);              }
+	unsigned takeReadISR    ( void )         { return rwl_takeReadISR   (this);              }
+	unsigned waitReadFor    ( cnt_t _delay ) { return rwl_waitReadFor   (this, _delay);      }
+	unsigned waitReadUntil  ( cnt_t _time )  { return rwl_waitReadUntil (this, _time);       }
+	unsigned waitRead       ( void )         { return rwl_waitRead      (this);              }
+	unsigned lockRead       ( void )         { return rwl_lockRead      (this);              }
+	unsigned giveRead       ( void )         { return rwl_giveRead      (this);              }
+	unsigned unlockRead     ( void )         { return rwl_unlockRead    (this);              }
+	unsigned giveReadISR    ( void )         { return rwl_giveReadISR   (this);              }
+	unsigned takeWrite      ( void )         { return rwl_takeWrite     (this);              }
+	unsigned tryLockWrite   ( void )         { return rwl_tryLockWrite  (this);              }
+	unsigned waitWriteFor   ( cnt_t _delay ) { return rwl_waitWriteFor  (this, _delay);      }
+	unsigned waitWriteUntil ( cnt_t _time )  { return rwl_waitWriteUntil(this, _time);       }
+	unsigned waitWrite      ( void )         { return rwl_waitWrite     (this);              }
+	unsigned lockWrite      ( void )         { return rwl_lockWrite     (this);              }
+	unsigned giveWrite      ( void )         { return rwl_giveWrite     (this);              }
+	unsigned unlockWrite    ( void )         { return rwl_unlockWrite   (this);              }
+	void     lock           ( void )         {        rwl_lockWrite     (this);              }
+	bool     try_lock       ( void )         { return rwl_tryLockWrite  (this) == E_SUCCESS; }
+	void     unlock         ( void )         {        rwl_unlockWrite   (this);              }
+	void     lock_shared    ( void )         {        rwl_lockRead      (this);              }
+	bool     try_lock_shared( void )         { return rwl_tryLockRead   (this) == E_SUCCESS; }
+	void     unlock_shared  ( void )         {        rwl_unlockRead    (this);              }
+};
+
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_RWL_H
@@ -0,0 +1,455 @@
+/******************************************************************************
+
+    @file    StateOS: osrpc.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#ifndef __STATEOS_RPC_H
+#define __STATEOS_RPC_H
+
+#include "oskernel.h"
+
+/******************************************************************************
+ *
+ * Name              : remote procedure call
+ *                     synchronous rendezvous between a client and a server task
+ *                     like a QNX MsgSend / MsgReceive / MsgReply
+ *
+ ******************************************************************************/
+
+struct __rpc
+{
+	obj_t    obj;    // object header; queue of clients waiting for the server
+
+	tsk_t  * server; // queue of servers waiting for a request
+	tsk_t  * client; // client being served
+	tsk_t  * owner;  // server serving the client
+	rpc_t  * list;   // next object in the list of calls served by owner
+	rpc_t ** back;   // previous object in the list of calls served by owner
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _RPC_INIT
+ *
+ * Description       : create and initialize a remote procedure call object
+ *
+ * Parameters        : none
+ *
+ * Return            : remote procedure call object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _RPC_INIT() { _OBJ_INIT(), 0, 0, 0, 0, 0 }
+
+/******************************************************************************
+ *
+ * Name              : OS_RPC
+ *
+ * Description       : define and initialize a remote procedure call object
+ *
+ * Parameters
+ *   rpc             : name of a pointer to remote procedure call object
+ *
+ ******************************************************************************/
+
+#define             OS_RPC( rpc )                     \
+                       rpc_t rpc##__rpc = _RPC_INIT(); \
+                       rpc_id rpc = & rpc##__rpc
+
+/******************************************************************************
+ *
+ * Name              : static_RPC
+ *
+ * Description       : define and initialize a static remote procedure call object
+ *
+ * Parameters
+ *   rpc             : name of a pointer to remote procedure call object
+ *
+ ******************************************************************************/
+
+#define         static_RPC( rpc )                     \
+                static rpc_t rpc##__rpc = _RPC_INIT(); \
+                static rpc_id rpc = & rpc##__rpc
+
+/******************************************************************************
+ *
+ * Name              : RPC_INIT
+ *
+ * Description       : create and initialize a remote procedure call object
+ *
+ * Parameters        : none
+ *
+ * Return            : remote procedure call object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                RPC_INIT() \
+                      _RPC_INIT()
+#endif
+
+/******************************************************************************
+ *
+ * Name              : RPC_CREATE
+ * Alias             : RPC_NEW
+ *
+ * Description       : create and initialize a remote procedure call object
+ *
+ * Parameters        : none
+ *
+ * Return            : pointer to remote procedure call object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                RPC_CREATE() \
+           (rpc_t[]) { RPC_INIT  () }
+#define                RPC_NEW \
+                       RPC_CREATE
+#endif
+
+/******************************************************************************
+ *
+ * Name              : rpc_init
+ *
+ * Description       : initialize a remote procedure call object
+ *
+ * Parameters
+ *   rpc             : pointer to remote procedure call object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void rpc_init( rpc_t *rpc );
+
+/******************************************************************************
+ *
+ * Name              : rpc_create
+ * Alias             : rpc_new
+ *
+ * Description       : create and initialize a new remote procedure call object
+ *
+ * Parameters        : none
+ *
+ * Return            : pointer to remote procedure call object (remote procedure call object successfully created)
+ *   0               : remote procedure call object not created (not enough free memory)
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+rpc_t *rpc_create( void );
+
+__STATIC_INLINE
+rpc_t *rpc_new( void ) { return rpc_create(); }
+
+/******************************************************************************
+ *
+ * Name              : rpc_reset
+ * Alias             : rpc_kill
+ *
+ * Description       : reset the remote procedure call object and wake up all waiting clients and servers with 'E_STOPPED' event value
+ *
+ * Parameters
+ *   rpc             : pointer to remote procedure call object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void rpc_reset( rpc_t *rpc );
+
+__STATIC_INLINE
+void rpc_kill( rpc_t *rpc ) { rpc_reset(rpc); }
+
+/******************************************************************************
+ *
+ * Name              : rpc_destroy
+ * Alias             : rpc_delete
+ *
+ * Description       : reset the remote procedure call object, wake up all waiting clients and servers with 'E_DELETED' event value and free allocated resource
+ *
+ * Parameters
+ *   rpc             : pointer to remote procedure call object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void rpc_destroy( rpc_t *rpc );
+
+__STATIC_INLINE
+void rpc_delete( rpc_t *rpc ) { rpc_destroy(rpc); }
+
+/******************************************************************************
+ *
+ * Name              : rpc_callFor
+ *
+ * Description       : send a request to the server and wait for the reply for given duration of time
+ *                     if the server is waiting for a request, the processor is handed over to it directly
+ *                     and the server runs at the priority of the client until it replies
+ *
+ * Parameters
+ *   rpc             : pointer to remote procedure call object
+ *   data            : pointer to the request word; the reply is stored here
+ *   delay           : duration of time (maximum number of ticks to wait for the reply)
+ *                     IMMEDIATE: don't send the request (the call always waits for the reply)
+ *                     INFINITE:  wait indefinitely for the reply
+ *
+ * Return
+ *   E_SUCCESS       : the reply was successfully received
+ *   E_STOPPED       : remote procedure call object was reseted before the specified timeout expired
+ *   E_DELETED       : remote procedure call object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : the reply was not received before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     request and reply words are copied directly between the waiting tasks
+ *
+ ******************************************************************************/
+
+unsigned rpc_callFor( rpc_t *rpc, unsigned *data, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : rpc_callUntil
+ *
+ * Description       : send a request to the server and wait for the reply until given timepoint
+ *                     if the server is waiting for a request, the processor is handed over to it directly
+ *                     and the server runs at the priority of the client until it replies
+ *
+ * Parameters
+ *   rpc             : pointer to remote procedure call object
+ *   data            : pointer to the request word; the reply is stored here
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : the reply was successfully received
+ *   E_STOPPED       : remote procedure call object was reseted before the specified timeout expired
+ *   E_DELETED       : remote procedure call object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : the reply was not received before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     request and reply words are copied directly between the waiting tasks
+ *
+ ******************************************************************************/
+
+unsigned rpc_callUntil( rpc_t *rpc, unsigned *data, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : rpc_call
+ *
+ * Description       : send a request to the server and wait indefinitely for the reply
+ *                     if the server is waiting for a request, the processor is handed over to it directly
+ *                     and the server runs at the priority of the client until it replies
+ *
+ * Parameters
+ *   rpc             : pointer to remote procedure call object
+ *   data            : pointer to the request word; the reply is stored here
+ *
+ * Return
+ *   E_SUCCESS       : the reply was successfully received
+ *   E_STOPPED       : remote procedure call object was reseted
+ *   E_DELETED       : remote procedure call object was deleted
+ *
+ * Note              : use only in thread mode
+ *                     request and reply words are copied directly between the waiting tasks
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+unsigned rpc_call( rpc_t *rpc, unsigned *data ) { return rpc_callFor(rpc, data, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : rpc_waitFor
+ *
+ * Description       : wait for a request from a client for given duration of time
+ *                     the server takes over the priority of the client until it replies
+ *
+ * Parameters
+ *   rpc             : pointer to remote procedure call object
+ *   data            : pointer to store the request word
+ *   delay           : duration of time (maximum number of ticks to wait for a request)
+ *                     IMMEDIATE: don't wait if there is no pending request
+ *                     INFINITE:  wait indefinitely for a request
+ *
+ * Return
+ *   E_SUCCESS       : a request was successfully received
+ *   E_FAILURE       : the previous request has not been replied yet
+ *   E_STOPPED       : remote procedure call object was reseted before the specified timeout expired
+ *   E_DELETED       : remote procedure call object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : no request was received before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     only one request is served at a time
+ *
+ ******************************************************************************/
+
+unsigned rpc_waitFor( rpc_t *rpc, unsigned *data, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : rpc_waitUntil
+ *
+ * Description       : wait for a request from a client until given timepoint
+ *                     the server takes over the priority of the client until it replies
+ *
+ * Parameters
+ *   rpc             : pointer to remote procedure call object
+ *   data            : pointer to store the request word
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : a request was successfully received
+ *   E_FAILURE       : the previous request has not been replied yet
+ *   E_STOPPED       : remote procedure call object was reseted before the specified timeout expired
+ *   E_DELETED       : remote procedure call object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : no request was received before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     only one request is served at a time
+ *
+ ******************************************************************************/
+
+unsigned rpc_waitUntil( rpc_t *rpc, unsigned *data, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : rpc_wait
+ *
+ * Description       : wait indefinitely for a request from a client
+ *                     the server takes over the priority of the client until it replies
+ *
+ * Parameters
+ *   rpc             : pointer to remote procedure call object
+ *   data            : pointer to store the request word
+ *
+ * Return
+ *   E_SUCCESS       : a request was successfully received
+ *   E_FAILURE       : the previous request has not been replied yet
+ *   E_STOPPED       : remote procedure call object was reseted
+ *   E_DELETED       : remote procedure call object was deleted
+ *
+ * Note              : use only in thread mode
+ *                     only one request is served at a time
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+unsigned rpc_wait( rpc_t *rpc, unsigned *data ) { return rpc_waitFor(rpc, data, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : rpc_reply
+ *
+ * Description       : send the reply to the client being served, restore the priority of the server
+ *                     and hand the processor over to the client directly
+ *
+ * Parameters
+ *   rpc             : pointer to remote procedure call object
+ *   data            : reply word
+ *
+ * Return
+ *   E_SUCCESS       : the reply was successfully delivered
+ *   E_FAILURE       : the current task is not serving a call of the remote procedure call object
+ *                     or there is no client waiting for the reply (e.g. the call has timed out)
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned rpc_reply( rpc_t *rpc, unsigned data );
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+
+/******************************************************************************
+ *
+ * Class             : RemoteCall
+ *
+ * Description       : create and initialize a remote procedure call object
+ *
+ * Constructor parameters
+ *                   : none
+ *
+ ******************************************************************************/
+
+struct RemoteCall : public __rpc
+{
+	 RemoteCall( void ): __rpc _RPC_INIT() {}
+	~RemoteCall( void ) { assert(__rpc::obj.queue == nullptr && __rpc::server == nullptr && __rpc::client == nullptr); }
+
+	static
+	RemoteCall *create( void )
+	{
+		static_assert(sizeof(__rpc) == sizeof(RemoteCall), "unexpected error!");
+		return reinterpret_cast<RemoteCall *>(rpc_create());
+	}
+
+	void     reset    ( void )                         {        rpc_reset    (this);                }
+	void     kill     ( void )                         {        rpc_kill     (this);                }
+	void     destroy  ( void )                         {        rpc_destroy  (this);                }
+	unsigned callFor  ( unsigned*_data, cnt_t _delay ) { return rpc_callFor  (this, _data, _delay); }
+	unsigned callUntil( unsigned*_data, cnt_t _time )  { return rpc_callUntil(this, _data, _time);  }
+	unsigned call     ( unsigned*_data )               { return rpc_call     (this, _data);         }
+	unsigned waitFor  ( unsigned*_data, cnt_t _delay ) { return rpc_waitFor  (this, _data, _delay); }
+	unsigned waitUntil( unsigned*_data, cnt_t _time )  { return rpc_waitUntil(this, _data, _time);  }
+	unsigned wait     ( unsigned*_data )               { return rpc_wait     (this, _data);         }
+	unsigned reply    ( unsigned _data )               { return rpc_reply    (this, _data);         }
+};
+
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_RPC_H
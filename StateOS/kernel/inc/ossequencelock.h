@@ -0,0 +1,402 @@
+/******************************************************************************
+
+    @file    StateOS: ossequencelock.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#ifndef __STATEOS_SEQ_H
+#define __STATEOS_SEQ_H
+
+#include "oskernel.h"
+#include "oscriticalsection.h"
+
+/******************************************************************************
+ *
+ * Name              : sequence lock
+ *
+ * Note              : writers are serialized by disabling interrupts,
+ *                     readers never disable interrupts and retry if the data has been changed during reading
+ *
+ ******************************************************************************/
+
+typedef volatile unsigned seq_t, * const seq_id;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _SEQ_INIT
+ *
+ * Description       : create and initialize a sequence lock object
+ *
+ * Parameters        : none
+ *
+ * Return            : sequence lock object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _SEQ_INIT()   0
+
+/******************************************************************************
+ *
+ * Name              : OS_SEQ
+ *
+ * Description       : define and initialize a sequence lock object
+ *
+ * Parameters
+ *   seq             : name of a pointer to sequence lock object
+ *
+ ******************************************************************************/
+
+#define             OS_SEQ( seq )                     \
+                       seq_t seq##__seq = _SEQ_INIT(); \
+                       seq_id seq = & seq##__seq
+
+/******************************************************************************
+ *
+ * Name              : static_SEQ
+ *
+ * Description       : define and initialize a static sequence lock object
+ *
+ * Parameters
+ *   seq             : name of a pointer to sequence lock object
+ *
+ ******************************************************************************/
+
+#define         static_SEQ( seq )                     \
+                static seq_t seq##__seq = _SEQ_INIT(); \
+                static seq_id seq = & seq##__seq
+
+/******************************************************************************
+ *
+ * Name              : SEQ_INIT
+ *
+ * Description       : create and initialize a sequence lock object
+ *
+ * Parameters        : none
+ *
+ * Return            : sequence lock object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                SEQ_INIT() \
+                      _SEQ_INIT()
+#endif
+
+/******************************************************************************
+ *
+ * Name              : SEQ_CREATE
+ * Alias             : SEQ_NEW
+ *
+ * Description       : create and initialize a sequence lock object
+ *
+ * Parameters        : none
+ *
+ * Return            : pointer to sequence lock object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                SEQ_CREATE() \
+           (seq_t[]) { SEQ_INIT  () }
+#define                SEQ_NEW \
+                       SEQ_CREATE
+#endif
+
+/******************************************************************************
+ *
+ * Name              : core_seq_writeBegin
+ *
+ * Description       : mark the beginning of the write sequence (the sequence counter becomes odd)
+ *
+ * Parameters
+ *   seq             : pointer to sequence lock object
+ *
+ * Return            : none
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+void core_seq_writeBegin( seq_t *seq )
+{
+	*seq = *seq + 1;
+	port_set_sync();
+}
+
+/******************************************************************************
+ *
+ * Name              : core_seq_writeEnd
+ *
+ * Description       : mark the end of the write sequence (the sequence counter becomes even)
+ *
+ * Parameters
+ *   seq             : pointer to sequence lock object
+ *
+ * Return            : none
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+void core_seq_writeEnd( seq_t *seq )
+{
+	port_set_sync();
+	*seq = *seq + 1;
+}
+
+/******************************************************************************
+ *
+ * Name              : seq_init
+ *
+ * Description       : initialize a sequence lock object
+ *
+ * Parameters
+ *   seq             : pointer to sequence lock object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+void seq_init( seq_t *seq ) { *seq = 0; }
+
+/******************************************************************************
+ *
+ * Name              : seq_writeBegin
+ * ISR alias         : seq_writeBeginISR
+ *
+ * Description       : save interrupts state, disable interrupts then begin the write sequence
+ *                   / enter into critical section
+ *
+ * Parameters
+ *   seq             : pointer to sequence lock object
+ *
+ * Return            : none
+ *
+ * Note              : do not use waiting functions inside seq_writeBegin / seq_writeEnd
+ *                     may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+#define                seq_writeBegin(seq) \
+                       sys_lock(); core_seq_writeBegin(seq)
+
+#define                seq_writeBeginISR(seq) \
+                       seq_writeBegin(seq)
+
+/******************************************************************************
+ *
+ * Name              : seq_writeEnd
+ * ISR alias         : seq_writeEndISR
+ *
+ * Description       : end the write sequence then restore saved interrupts state
+ *                   / exit from critical section
+ *
+ * Parameters
+ *   seq             : pointer to sequence lock object
+ *
+ * Return            : none
+ *
+ * Note              : do not use waiting functions inside seq_writeBegin / seq_writeEnd
+ *                     may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+#define                seq_writeEnd(seq) \
+                       core_seq_writeEnd(seq); sys_unlock()
+
+#define                seq_writeEndISR(seq) \
+                       seq_writeEnd(seq)
+
+/******************************************************************************
+ *
+ * Name              : seq_readBegin
+ *
+ * Description       : begin the read sequence
+ *
+ * Parameters
+ *   seq             : pointer to sequence lock object
+ *
+ * Return            : value of the sequence counter, to be passed to seq_readRetry
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+unsigned seq_readBegin( seq_t *seq )
+{
+	unsigned cnt = *seq;
+	port_set_sync();
+	return cnt;
+}
+
+/******************************************************************************
+ *
+ * Name              : seq_readRetry
+ *
+ * Description       : end the read sequence and check if the data has been changed during reading
+ *
+ * Parameters
+ *   seq             : pointer to sequence lock object
+ *   cnt             : value returned by seq_readBegin
+ *
+ * Return
+ *   true            : the data has been changed or was being changed, the read sequence must be repeated
+ *   false           : the data read is consistent
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+bool seq_readRetry( seq_t *seq, unsigned cnt )
+{
+	port_set_sync();
+	return (cnt & 1U) || (*seq != cnt);
+}
+
+/******************************************************************************
+ *
+ * Name              : seq_read
+ *
+ * Description       : copy the data protected by the sequence lock object,
+ *                     repeat the copy if the data has been changed in the meantime
+ *
+ * Parameters
+ *   seq             : pointer to sequence lock object
+ *   data            : pointer to the buffer for the copy of protected data
+ *   src             : pointer to protected data
+ *   size            : size of protected data (in bytes)
+ *
+ * Return            : none
+ *
+ * Note              : interrupts are not disabled
+ *                     may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+void seq_read( seq_t *seq, void *data, const void *src, size_t size )
+{
+	unsigned cnt;
+	do
+	{
+		cnt = seq_readBegin(seq);
+		memcpy(data, src, size);
+	}
+	while (seq_readRetry(seq, cnt));
+}
+
+/******************************************************************************
+ *
+ * Name              : seq_write
+ *
+ * Description       : update the data protected by the sequence lock object
+ *
+ * Parameters
+ *   seq             : pointer to sequence lock object
+ *   dst             : pointer to protected data
+ *   data            : pointer to the new value of protected data
+ *   size            : size of protected data (in bytes)
+ *
+ * Return            : none
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+void seq_write( seq_t *seq, void *dst, const void *data, size_t size )
+{
+	seq_writeBegin(seq);
+	memcpy(dst, data, size);
+	seq_writeEnd(seq);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+
+#include <type_traits>
+
+/******************************************************************************
+ *
+ * Class             : SeqLocked<>
+ *
+ * Description       : create and initialize an object of type T protected by the sequence lock
+ *
+ * Constructor parameters
+ *   data            : initial value of protected object
+ *
+ * Note              : T must be trivially copyable
+ *
+ ******************************************************************************/
+
+template<class T>
+struct SeqLocked
+{
+	static_assert(std::is_trivially_copyable<T>::value, "protected object must be trivially copyable!");
+
+	 SeqLocked( void ):           seq(_SEQ_INIT()), data()      {}
+	 SeqLocked( const T &_data ): seq(_SEQ_INIT()), data(_data) {}
+
+	T          load      ( void )           { T _data; seq_read (&seq, &_data, &data, sizeof(T)); return _data; }
+	void       store     ( const T &_data ) {          seq_write(&seq, &data, &_data, sizeof(T));               }
+	           operator T( void )           { return load();                                                   }
+	SeqLocked &operator= ( const T &_data ) { store(_data); return *this;                                      }
+
+	private:
+	seq_t seq;
+	T     data;
+};
+
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_SEQ_H
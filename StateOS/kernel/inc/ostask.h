@@ -52,6 +52,33 @@
 #define JOINABLE     ((tsk_t *)((uintptr_t)0))     // task in joinable state
 #define DETACHED     ((tsk_t *)((uintptr_t)0 - 1)) // task in detached state
 
+/******************************************************************************
+ *
+ * Name              : periodic task record
+ *
+ ******************************************************************************/
+
+struct __prd
+{
+	cnt_t    period; // period of the task
+	cnt_t    release;// absolute release time of the current job
+	fun_t  * hook;   // overrun hook, called by the task when a deadline miss is detected
+	unsigned count;  // number of completed jobs
+	unsigned miss;   // number of deadline misses
+
+	struct {
+	cnt_t    min;
+	cnt_t    max;
+	cnt_t    sum;
+	}        rsp;    // response time (from the release to the end of the job)
+
+	struct {
+	cnt_t    min;
+	cnt_t    max;
+	cnt_t    sum;
+	}        jit;    // release jitter (from the release to the resumption of the task)
+};
+
 /******************************************************************************
  *
  * Name              : task (thread)
@@ -64,14 +91,16 @@ struct __tsk
 
 	fun_t  * state; // task state (initial task function, doesn't have to be noreturn-type)
 #if OS_FUNCTIONAL
-	FUN_t    fun;   // function<void(void)> for internal use in c++ functions
+	FUN_t    fun;   // delegate<void(void)> for internal use in c++ functions
 #define     _FUN_INIT(_state) _state, { 0 }
 #else
 #define     _FUN_INIT(_state) _state
 #endif
 	cnt_t    start; // inherited from timer
 	cnt_t    delay; // inherited from timer
+	cnt_t    slack; // inherited from timer
 	cnt_t    slice;	// time slice
+	cnt_t    deadline;// absolute deadline (used in the EDF band)
 
 	tsk_t ** back;  // previous object in the BLOCKED queue
 	stk_t  * stack; // base of stack
@@ -85,17 +114,28 @@ struct __tsk
 	tsk_t ** guard; // BLOCKED queue for the pending process
 
 	unsigned event; // wakeup event
+	unsigned act;   // basic task: 1 + number of pending activations (0 for the regular task)
+
+	prd_t  * prd;   // periodic task record
 
 	struct {
 	mtx_t  * list;  // list of mutexes held
 	mtx_t  * tree;  // tree of tasks waiting for mutexes
 	}        mtx;
 
+	struct {
+	rwl_t  * list;  // list of reader-writer locks held for writing
+	}        rwl;
+
+	struct {
+	rpc_t  * list;  // list of remote procedure calls being served
+	}        rpc;
+
 	struct {
 	unsigned sigset;// pending signals
 	act_t  * action;// signal handler
 #if OS_FUNCTIONAL
-	ACT_t    act;   // function<void(unsigned)> for internal use in c++ functions
+	ACT_t    act;   // delegate<void(unsigned)> for internal use in c++ functions
 #define     _ACT_INIT() 0, { 0 }
 #else
 #define     _ACT_INIT() 0
@@ -164,11 +204,35 @@ struct __tsk
 
 	struct {
 	union  {
-	fun_t  * out;
-	fun_t ** in;
+	const
+	jbe_t  * out;
+	jbe_t  * in;
 	}        data;
 	}        job;   // temporary data used by job queue object
 
+	struct {
+	volatile
+	unsigned*addr;
+	}        fut;   // temporary data used by futex
+
+	struct {
+	mtx_t  * mtx;
+	}        cnd;   // temporary data used by condition variable object
+
+	struct {
+	pol_t  * list;
+	unsigned count;
+	tsk_t  * queue;
+	}        pol;   // temporary data used by poll services
+
+	struct {
+	exe_t  * exe;
+	}        exe;   // temporary data used by executor object
+
+	struct {
+	unsigned*data;
+	}        rpc;   // temporary data used by remote procedure call object
+
 	}        tmp;
 #if defined(__ARMCC_VERSION) && !defined(__MICROLIB)
 	char     libspace[96];
@@ -209,7 +273,28 @@ extern "C" {
  ******************************************************************************/
 
 #define               _TSK_INIT( _prio, _state, _stack, _size ) \
-                       { _HDR_INIT(), _FUN_INIT(_state), 0, 0, 0, 0, _stack, _size, 0, _prio, _prio, 0, 0, 0, { 0, 0 }, { 0, _ACT_INIT(), { 0, 0 } }, { { 0 } }, _TSK_EXTRA }
+                       { _HDR_INIT(), _FUN_INIT(_state), 0, 0, 0, 0, 0, 0, _stack, _size, 0, _prio, _prio, 0, 0, 0, 0, 0, { 0, 0 }, { 0 }, { 0 }, { 0, _ACT_INIT(), { 0, 0 } }, { { 0 } }, _TSK_EXTRA }
+
+/******************************************************************************
+ *
+ * Name              : _BSK_INIT
+ *
+ * Description       : create and initialize a basic task object
+ *
+ * Parameters
+ *   prio            : task priority (any unsigned int value); all basic tasks sharing the stack must have the same priority
+ *   state           : task state (task function), it is executed to completion once for every activation
+ *   stack           : base of shared stack storage
+ *   size            : size of shared stack (in bytes)
+ *
+ * Return            : basic task object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _BSK_INIT( _prio, _state, _stack, _size ) \
+                       { _HDR_INIT(), _FUN_INIT(_state), 0, 0, 0, 0, 0, 0, _stack, _size, 0, _prio, _prio, 0, 0, 0, 1, 0, { 0, 0 }, { 0 }, { 0 }, { 0, _ACT_INIT(), { 0, 0 } }, { { 0 } }, _TSK_EXTRA }
 
 /******************************************************************************
  *
@@ -496,6 +581,74 @@ extern "C" {
 #define         static_TSK_START( tsk, prio, ... ) \
                 static_WRK_START( tsk, prio, _VA_STK(__VA_ARGS__) )
 
+/******************************************************************************
+ *
+ * Name              : OS_STK
+ *
+ * Description       : define stack storage shared by basic tasks
+ *
+ * Parameters
+ *   stk             : name of the shared stack storage
+ *   size            : (optional) size of the shared stack (in bytes); default: OS_STACK_SIZE
+ *
+ ******************************************************************************/
+
+#define             OS_STK( stk, ... ) \
+                       stk_t stk[STK_SIZE(_VA_STK(__VA_ARGS__))]
+
+/******************************************************************************
+ *
+ * Name              : OS_BSK
+ *
+ * Description       : define and initialize basic task object (run-to-completion task on the shared stack)
+ *                     the task is not started; use tsk_activate to run it
+ *
+ * Parameters
+ *   tsk             : name of a pointer to basic task object
+ *   prio            : task priority (any unsigned int value); all basic tasks sharing the stack must have the same priority
+ *   state           : task state (task function), it is executed to completion once for every activation
+ *   stk             : name of the shared stack storage (defined with OS_STK / static_STK)
+ *
+ ******************************************************************************/
+
+#define             OS_BSK( tsk, prio, state, stk )                                   \
+                       tsk_t tsk##__bsk = _BSK_INIT( prio, state, stk, sizeof(stk) ); \
+                       tsk_id tsk = & tsk##__bsk
+
+/******************************************************************************
+ *
+ * Name              : static_STK
+ *
+ * Description       : define static stack storage shared by basic tasks
+ *
+ * Parameters
+ *   stk             : name of the shared stack storage
+ *   size            : (optional) size of the shared stack (in bytes); default: OS_STACK_SIZE
+ *
+ ******************************************************************************/
+
+#define         static_STK( stk, ... ) \
+                static stk_t stk[STK_SIZE(_VA_STK(__VA_ARGS__))]
+
+/******************************************************************************
+ *
+ * Name              : static_BSK
+ *
+ * Description       : define and initialize static basic task object (run-to-completion task on the shared stack)
+ *                     the task is not started; use tsk_activate to run it
+ *
+ * Parameters
+ *   tsk             : name of a pointer to basic task object
+ *   prio            : task priority (any unsigned int value); all basic tasks sharing the stack must have the same priority
+ *   state           : task state (task function), it is executed to completion once for every activation
+ *   stk             : name of the shared stack storage (defined with OS_STK / static_STK)
+ *
+ ******************************************************************************/
+
+#define         static_BSK( tsk, prio, state, stk )                                   \
+                static tsk_t tsk##__bsk = _BSK_INIT( prio, state, stk, sizeof(stk) ); \
+                static tsk_id tsk = & tsk##__bsk
+
 /******************************************************************************
  *
  * Name              : WRK_INIT
@@ -637,6 +790,32 @@ tsk_t *cur_task( void ) { return System.cur; }
 
 void tsk_init( tsk_t *tsk, unsigned prio, fun_t *state, stk_t *stack, unsigned size );
 
+/******************************************************************************
+ *
+ * Name              : tsk_initBasic
+ *
+ * Description       : initialize basic task object (run-to-completion task on the shared stack)
+ *                     the task is not started; use tsk_activate to run it
+ *
+ * Parameters
+ *   tsk             : pointer to basic task object
+ *   prio            : task priority (any unsigned int value); all basic tasks sharing the stack must have the same priority
+ *   state           : task state (task function), it is executed to completion once for every activation
+ *   stack           : base of shared stack storage
+ *   size            : size of shared stack (in bytes)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     basic tasks sharing the stack must not block, sleep, yield, change the priority
+ *                     or use the EDF band; they can't receive signals
+ *                     they can lock mutexes with mtxPrioCeiling protocol, which never block them
+ *                     the stack must be large enough for the deepest of the task functions
+ *
+ ******************************************************************************/
+
+void tsk_initBasic( tsk_t *tsk, unsigned prio, fun_t *state, stk_t *stack, unsigned size );
+
 /******************************************************************************
  *
  * Name              : wrk_create
@@ -1010,6 +1189,89 @@ void tsk_prio( unsigned prio ) { tsk_setPrio(prio); }
 
 unsigned tsk_getPrio( void );
 
+/******************************************************************************
+ *
+ * Name              : tsk_setSlack
+ *
+ * Description       : set the tolerance of wakeup time of current task for all next timed waits
+ *
+ * Parameters
+ *   slack           : maximum number of ticks the wakeup may be delayed to be coalesced with other timers
+ *                     0: wakeup exactly at the end of the timeout (default)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     used only in tick-less mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+void tsk_setSlack( cnt_t slack ) { System.cur->slack = slack; }
+
+/******************************************************************************
+ *
+ * Name              : tsk_setDeadline
+ *
+ * Description       : set absolute deadline of current task
+ *
+ * Parameters
+ *   deadline        : timepoint value
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     used only when current task has priority OS_EDF_PRIO (EDF band)
+ *                     ready tasks of the EDF band are ordered by their deadlines (the earliest first)
+ *
+ ******************************************************************************/
+
+void tsk_setDeadline( cnt_t deadline );
+
+/******************************************************************************
+ *
+ * Name              : tsk_setPeriod
+ *
+ * Description       : make current task periodic, the first job is released now
+ *                     reset statistics of the periodic task record
+ *
+ * Parameters
+ *   prd             : pointer to the periodic task record
+ *                     0: current task is no longer periodic
+ *   period          : period of the task (also its relative deadline, set as the task deadline in the EDF band)
+ *   hook            : overrun hook, called by the task itself when a deadline miss is detected
+ *                     0: no overrun hook
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void tsk_setPeriod( prd_t *prd, cnt_t period, fun_t *hook );
+
+/******************************************************************************
+ *
+ * Name              : tsk_waitNextPeriod
+ *
+ * Description       : finish the current job of periodic task,
+ *                     update statistics and delay execution of current task until the next release time
+ *                     releases that have already passed are skipped, so the task keeps its phase
+ *
+ * Parameters        : none
+ *
+ * Return
+ *   E_SUCCESS       : the job has been finished before its deadline
+ *   E_TIMEOUT       : deadline of the job has been missed
+ *
+ * Note              : use only in thread mode
+ *                     statistics cost O(1) per period
+ *                     average values are the sums divided by the number of completed jobs
+ *
+ ******************************************************************************/
+
+unsigned tsk_waitNextPeriod( void );
+
 /******************************************************************************
  *
  * Name              : tsk_sleepFor
@@ -1033,6 +1295,29 @@ void tsk_sleepFor( cnt_t delay );
 __STATIC_INLINE
 void tsk_delay( cnt_t delay ) { tsk_sleepFor(delay); }
 
+/******************************************************************************
+ *
+ * Name              : tsk_sleepForUs
+ *
+ * Description       : delay execution of current task for given number of microseconds
+ *
+ * Parameters
+ *   usec            : duration of time (number of microseconds to delay execution of current task)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     tick-less mode: the task sleeps for the delay rounded up to the whole system ticks,
+ *                     so the resolution is 1/OS_FREQUENCY (set OS_FREQUENCY to 1000000 for microsecond resolution)
+ *                     tick mode: the task sleeps until the last system tick before the end of the delay,
+ *                     then spins (yielding only to tasks of the same priority) for the rest of the delay
+ *                     measured by sys_hrtime; the spin is shorter than one system tick and tasks of lower priority
+ *                     don't run during it, so use it for short delays with care
+ *
+ ******************************************************************************/
+
+void tsk_sleepForUs( uint32_t usec );
+
 /******************************************************************************
  *
  * Name              : tsk_sleepNext
@@ -1150,6 +1435,31 @@ unsigned tsk_resume( tsk_t *tsk );
 __STATIC_INLINE
 unsigned tsk_resumeISR( tsk_t *tsk ) { return tsk_resume(tsk); }
 
+/******************************************************************************
+ *
+ * Name              : tsk_activate
+ * ISR alias         : tsk_activateISR
+ *
+ * Description       : activate given basic task ("run again"); the task function is executed to completion
+ *                     on the shared stack; activations of a ready or running task are queued
+ *                     and the task function is executed once more for each of them
+ *
+ * Parameters
+ *   tsk             : pointer to basic task object
+ *
+ * Return
+ *   E_SUCCESS       : task was successfully activated
+ *   E_FAILURE       : activation counter overflow
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+unsigned tsk_activate( tsk_t *tsk );
+
+__STATIC_INLINE
+unsigned tsk_activateISR( tsk_t *tsk ) { return tsk_activate(tsk); }
+
 /******************************************************************************
  *
  * Name              : tsk_give
@@ -1380,6 +1690,50 @@ struct startTaskT : public TaskT<size_>
 
 typedef startTaskT<OS_STACK_SIZE> startTask;
 
+/******************************************************************************
+ *
+ * Class             : SharedStackT<>
+ *
+ * Description       : create stack storage shared by basic tasks
+ *
+ * Constructor parameters
+ *   size            : size of the shared stack (in bytes)
+ *
+ ******************************************************************************/
+
+template<unsigned size_ = OS_STACK_SIZE>
+struct SharedStackT
+{
+	stk_t stack_[STK_SIZE(size_)];
+};
+
+/* -------------------------------------------------------------------------- */
+
+typedef SharedStackT<OS_STACK_SIZE> SharedStack;
+
+/******************************************************************************
+ *
+ * Class             : BasicTask
+ *
+ * Description       : create and initialize basic task object (run-to-completion task on the shared stack)
+ *                     the task is not started; use activate to run it
+ *
+ * Constructor parameters
+ *   prio            : task priority (any unsigned int value); all basic tasks sharing the stack must have the same priority
+ *   state           : task state (task function), it is executed to completion once for every activation
+ *   stk             : shared stack storage
+ *
+ ******************************************************************************/
+
+struct BasicTask : public baseTask
+{
+	template<unsigned size_>
+	BasicTask( const unsigned _prio, FUN_t _state, SharedStackT<size_> &_stk ): baseTask(_prio, _state, _stk.stack_, sizeof(_stk.stack_)) { __tsk::act = 1; }
+
+	unsigned activate   ( void ) { return tsk_activate   (this); }
+	unsigned activateISR( void ) { return tsk_activateISR(this); }
+};
+
 /******************************************************************************
  *
  * Namespace         : ThisTask
@@ -1407,7 +1761,12 @@ namespace ThisTask
 	static inline void     prio      ( unsigned _prio )   {        tsk_prio      (_prio);   }
 	static inline unsigned getPrio   ( void )             { return tsk_getPrio   ();        }
 	static inline unsigned prio      ( void )             { return tsk_getPrio   ();        }
+	static inline void     setSlack  ( cnt_t    _slack )  {        tsk_setSlack  (_slack);  }
+	static inline void     setDeadline( cnt_t   _deadline ) {       tsk_setDeadline(_deadline); }
+	static inline void     setPeriod ( prd_t *  _prd, cnt_t _period, fun_t *_hook = nullptr ) { tsk_setPeriod(_prd, _period, _hook); }
+	static inline unsigned waitNextPeriod( void )         { return tsk_waitNextPeriod(); }
 	static inline void     sleepFor  ( cnt_t    _delay )  {        tsk_sleepFor  (_delay);  }
+	static inline void     sleepForUs( uint32_t _usec )   {        tsk_sleepForUs(_usec);   }
 	static inline void     sleepNext ( cnt_t    _delay )  {        tsk_sleepNext (_delay);  }
 	static inline void     sleepUntil( cnt_t    _time )   {        tsk_sleepUntil(_time);   }
 	static inline void     sleep     ( void )             {        tsk_sleep     ();        }
@@ -0,0 +1,287 @@
+/******************************************************************************
+
+    @file    StateOS: ostimeout.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOS_TMO_H
+#define __STATEOS_TMO_H
+
+#include "oskernel.h"
+
+/******************************************************************************
+ *
+ * Name              : timeout
+ *
+ ******************************************************************************/
+
+struct __tmo
+{
+	tmo_t  * prev;  // previous timeout in the timeouts queue
+	tmo_t  * next;  // next timeout in the timeouts queue; 0: timeout is not armed
+	cnt_t    time;  // expiration time
+	cbk_t  * fun;   // callback procedure
+	void   * arg;   // argument of the callback procedure
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _TMO_INIT
+ *
+ * Description       : create and initialize a timeout object
+ *
+ * Parameters
+ *   fun             : callback procedure
+ *   arg             : argument of the callback procedure
+ *
+ * Return            : timeout object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _TMO_INIT( _fun, _arg ) { 0, 0, 0, _fun, _arg }
+
+/******************************************************************************
+ *
+ * Name              : OS_TMO
+ *
+ * Description       : define and initialize a timeout object
+ *
+ * Parameters
+ *   tmo             : name of a pointer to timeout object
+ *   fun             : callback procedure
+ *   arg             : argument of the callback procedure
+ *
+ ******************************************************************************/
+
+#define             OS_TMO( tmo, fun, arg )                     \
+                       tmo_t tmo##__tmo = _TMO_INIT( fun, arg ); \
+                       tmo_id tmo = & tmo##__tmo
+
+/******************************************************************************
+ *
+ * Name              : static_TMO
+ *
+ * Description       : define and initialize a static timeout object
+ *
+ * Parameters
+ *   tmo             : name of a pointer to timeout object
+ *   fun             : callback procedure
+ *   arg             : argument of the callback procedure
+ *
+ ******************************************************************************/
+
+#define         static_TMO( tmo, fun, arg )                     \
+                static tmo_t tmo##__tmo = _TMO_INIT( fun, arg ); \
+                static tmo_id tmo = & tmo##__tmo
+
+/******************************************************************************
+ *
+ * Name              : TMO_INIT
+ *
+ * Description       : create and initialize a timeout object
+ *
+ * Parameters
+ *   fun             : callback procedure
+ *   arg             : argument of the callback procedure
+ *
+ * Return            : timeout object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                TMO_INIT( fun, arg ) \
+                      _TMO_INIT( fun, arg )
+#endif
+
+/******************************************************************************
+ *
+ * Name              : TMO_CREATE
+ * Alias             : TMO_NEW
+ *
+ * Description       : create and initialize a timeout object
+ *
+ * Parameters
+ *   fun             : callback procedure
+ *   arg             : argument of the callback procedure
+ *
+ * Return            : pointer to timeout object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                TMO_CREATE( fun, arg ) \
+           (tmo_t[]) { TMO_INIT  ( fun, arg ) }
+#define                TMO_NEW \
+                       TMO_CREATE
+#endif
+
+/******************************************************************************
+ *
+ * Name              : tmo_init
+ *
+ * Description       : initialize a timeout object
+ *
+ * Parameters
+ *   tmo             : pointer to timeout object
+ *   fun             : callback procedure
+ *   arg             : argument of the callback procedure
+ *
+ * Return            : none
+ *
+ * Note              : may be used both in thread and handler mode
+ *                     timeout object must not be armed
+ *
+ ******************************************************************************/
+
+void tmo_init( tmo_t *tmo, cbk_t *fun, void *arg );
+
+/******************************************************************************
+ *
+ * Name              : tmo_start
+ *
+ * Description       : arm (or re-arm) the timeout for given duration of time
+ *                     when the countdown has finished, the callback procedure is launched from the timer interrupt
+ *
+ * Parameters
+ *   tmo             : pointer to timeout object
+ *   delay           : duration of time (maximum number of ticks to countdown)
+ *                     IMMEDIATE: expire as soon as possible
+ *
+ * Return            : none
+ *
+ * Note              : may be used both in thread and handler mode
+ *                     delay must be less than half of the range of the system counter
+ *
+ ******************************************************************************/
+
+void tmo_start( tmo_t *tmo, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : tmo_startUntil
+ *
+ * Description       : arm (or re-arm) the timeout until given timepoint
+ *                     when the countdown has finished, the callback procedure is launched from the timer interrupt
+ *
+ * Parameters
+ *   tmo             : pointer to timeout object
+ *   time            : timepoint value
+ *
+ * Return            : none
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+void tmo_startUntil( tmo_t *tmo, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : tmo_stop
+ *
+ * Description       : cancel the timeout
+ *
+ * Parameters
+ *   tmo             : pointer to timeout object
+ *
+ * Return
+ *   E_SUCCESS       : timeout was armed and has been cancelled
+ *   E_FAILURE       : timeout was not armed (or has already expired)
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+unsigned tmo_stop( tmo_t *tmo );
+
+/******************************************************************************
+ *
+ * Name              : tmo_active
+ *
+ * Description       : check if the timeout is armed
+ *
+ * Parameters
+ *   tmo             : pointer to timeout object
+ *
+ * Return            : true if the timeout is armed
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+bool tmo_active( tmo_t *tmo ) { return tmo->next != 0; }
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+
+/******************************************************************************
+ *
+ * Class             : Timeout
+ *
+ * Description       : create and initialize a timeout object
+ *
+ * Constructor parameters
+ *   fun             : callback procedure
+ *   arg             : argument of the callback procedure
+ *
+ ******************************************************************************/
+
+struct Timeout : public __tmo
+{
+	 Timeout( cbk_t *_fun, void *_arg = nullptr ): __tmo _TMO_INIT(_fun, _arg) {}
+	~Timeout( void ) { assert(__tmo::next == nullptr); }
+
+	void     start     ( cnt_t _delay ) {        tmo_start     (this, _delay); }
+	void     startUntil( cnt_t _time )  {        tmo_startUntil(this, _time);  }
+	unsigned stop      ( void )         { return tmo_stop      (this);         }
+	bool     active    ( void )         { return tmo_active    (this);         }
+
+	bool     operator! ( void )         { return __tmo::next == nullptr;       }
+};
+
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_TMO_H
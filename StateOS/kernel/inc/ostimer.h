@@ -46,14 +46,23 @@ struct __tmr
 
 	fun_t  * state; // callback procedure
 #if OS_FUNCTIONAL
-	FUN_t    fun;   // function<void(void)> for internal use in c++ functions
+	FUN_t    fun;   // delegate<void(void)> for internal use in c++ functions
 #define     _FUN_INIT(_state) _state, { 0 }
 #else
 #define     _FUN_INIT(_state) _state
 #endif
 	cnt_t    start;
 	cnt_t    delay;
+	cnt_t    slack; // tolerance of expiration time in tick-less mode
 	cnt_t    period;
+#if OS_TIMER_QUEUE > 0
+	bool     defer; // callback procedure is launched by the timer service task
+	bool     pend;  // timer is waiting in the queue of the timer service task
+	unsigned overrun; // number of expirations lost while the callback procedure was pending
+#define     _TMR_DEFER , false, false, 0
+#else
+#define     _TMR_DEFER
+#endif
 };
 
 #ifdef __cplusplus
@@ -76,7 +85,7 @@ extern "C" {
  *
  ******************************************************************************/
 
-#define               _TMR_INIT( _state ) { _HDR_INIT(), _FUN_INIT(_state), 0, 0, 0 }
+#define               _TMR_INIT( _state ) { _HDR_INIT(), _FUN_INIT(_state), 0, 0, 0, 0 _TMR_DEFER }
 
 /******************************************************************************
  *
@@ -303,11 +312,12 @@ extern "C" {
  * Return            : current timer object
  *
  * Note              : use only in timer callback procedure
+ *                     deferred callback procedures are launched in thread mode by the timer service task
  *
  ******************************************************************************/
 
 __STATIC_INLINE
-tmr_t *tmr_thisISR( void ) { return (tmr_t *) WAIT.hdr.next; }
+tmr_t *tmr_thisISR( void ) { return System.tmr; }
 
 /******************************************************************************
  *
@@ -548,6 +558,71 @@ void tmr_startUntil( tmr_t *tmr, cnt_t time );
 __STATIC_INLINE
 void tmr_stop( tmr_t *tmr ) { tmr_start(tmr, 0, 0); }
 
+/******************************************************************************
+ *
+ * Name              : tmr_setSlack
+ *
+ * Description       : set the tolerance of expiration time of the timer
+ *
+ * Parameters
+ *   tmr             : pointer to timer object
+ *   slack           : maximum number of ticks the expiration may be delayed to be coalesced with other timers
+ *                     0: timer expires exactly at the end of the countdown (default)
+ *
+ * Return            : none
+ *
+ * Note              : may be used both in thread and handler mode
+ *                     used only in tick-less mode
+ *
+ ******************************************************************************/
+
+void tmr_setSlack( tmr_t *tmr, cnt_t slack );
+
+#if OS_TIMER_QUEUE > 0
+
+/******************************************************************************
+ *
+ * Name              : tmr_setDeferred
+ *
+ * Description       : set the way the callback procedure of the timer is launched
+ *
+ * Parameters
+ *   tmr             : pointer to timer object
+ *   deferred        : false: callback procedure is launched directly from the timer interrupt
+ *                     true:  timer interrupt only puts the timer into the queue of the timer service task,
+ *                            callback procedure is launched by the timer service task (with priority OS_TIMER_PRIO)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     the timer service task is started with the first deferred expiration
+ *                     OS_TIMER_QUEUE should not be less than the number of deferred timers
+ *                     tmr_delayISR cannot be used in deferred callback procedure
+ *
+ ******************************************************************************/
+
+void tmr_setDeferred( tmr_t *tmr, bool deferred );
+
+/******************************************************************************
+ *
+ * Name              : tmr_getOverrun
+ *
+ * Description       : get and reset the overrun counter of the deferred timer
+ *
+ * Parameters
+ *   tmr             : pointer to timer object
+ *
+ * Return            : number of expirations lost because the callback procedure of the timer
+ *                     was still waiting in the queue of the timer service task (or the queue was full)
+ *
+ * Note              : may be used both in thread and handler mode
+ *
+ ******************************************************************************/
+
+unsigned tmr_getOverrun( tmr_t *tmr );
+
+#endif//OS_TIMER_QUEUE
+
 /******************************************************************************
  *
  * Name              : tmr_take
@@ -778,6 +853,11 @@ struct Timer : public __tmr
 	unsigned waitUntil( cnt_t _time )                               { return tmr_waitUntil    (this, _time);                   }
 	unsigned wait     ( void )                                      { return tmr_wait         (this);                          }
 
+	void     setSlack ( cnt_t _slack )                              {        tmr_setSlack     (this, _slack);                  }
+#if OS_TIMER_QUEUE > 0
+	void     setDeferred( bool _deferred )                          {        tmr_setDeferred  (this, _deferred);               }
+	unsigned getOverrun ( void )                                    { return tmr_getOverrun   (this);                          }
+#endif
 	bool     operator!( void )                                      { return __tmr::hdr.id == ID_STOPPED;                      }
 #if OS_FUNCTIONAL
 	static
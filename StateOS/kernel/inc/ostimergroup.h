@@ -0,0 +1,380 @@
+/******************************************************************************
+
+    @file    StateOS: ostimergroup.h
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOS_TMG_H
+#define __STATEOS_TMG_H
+
+#include "oskernel.h"
+#include "ostimer.h"
+
+/******************************************************************************
+ *
+ * Name              : timer group
+ *
+ ******************************************************************************/
+
+typedef struct __tmg tmg_t, * const tmg_id;
+
+struct __tmg
+{
+	tmr_t    tmr;   // timer of the group (the only entry of the group in the timers queue)
+	hdr_t    lst;   // list of member timers
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : tmg_handler
+ *
+ * Description       : callback procedure of the timer group
+ *                     launch callback procedures of all member timers (deferred member timers through the timer service task)
+ *                     and wake up all tasks waiting for them, in order; a callback procedure may restart its own timer
+ *
+ * Parameters        : none
+ *
+ * Return            : none
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+void tmg_handler( void );
+
+/******************************************************************************
+ *
+ * Name              : _TMG_INIT
+ *
+ * Description       : create and initialize a timer group object
+ *
+ * Parameters        : none
+ *
+ * Return            : timer group object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _TMG_INIT() { _TMR_INIT( tmg_handler ), _HDR_INIT() }
+
+/******************************************************************************
+ *
+ * Name              : OS_TMG
+ *
+ * Description       : define and initialize a timer group object
+ *
+ * Parameters
+ *   tmg             : name of a pointer to timer group object
+ *
+ ******************************************************************************/
+
+#define             OS_TMG( tmg )                     \
+                       tmg_t tmg##__tmg = _TMG_INIT(); \
+                       tmg_id tmg = & tmg##__tmg
+
+/******************************************************************************
+ *
+ * Name              : static_TMG
+ *
+ * Description       : define and initialize a static timer group object
+ *
+ * Parameters
+ *   tmg             : name of a pointer to timer group object
+ *
+ ******************************************************************************/
+
+#define         static_TMG( tmg )                     \
+                static tmg_t tmg##__tmg = _TMG_INIT(); \
+                static tmg_id tmg = & tmg##__tmg
+
+/******************************************************************************
+ *
+ * Name              : TMG_INIT
+ *
+ * Description       : create and initialize a timer group object
+ *
+ * Parameters        : none
+ *
+ * Return            : timer group object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                TMG_INIT() \
+                      _TMG_INIT()
+#endif
+
+/******************************************************************************
+ *
+ * Name              : TMG_CREATE
+ * Alias             : TMG_NEW
+ *
+ * Description       : create and initialize a timer group object
+ *
+ * Parameters        : none
+ *
+ * Return            : pointer to timer group object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                TMG_CREATE() \
+           (tmg_t[]) { TMG_INIT  () }
+#define                TMG_NEW \
+                       TMG_CREATE
+#endif
+
+/******************************************************************************
+ *
+ * Name              : tmg_init
+ *
+ * Description       : initialize a timer group object
+ *
+ * Parameters
+ *   tmg             : pointer to timer group object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void tmg_init( tmg_t *tmg );
+
+/******************************************************************************
+ *
+ * Name              : tmg_create
+ * Alias             : tmg_new
+ *
+ * Description       : create and initialize a new timer group object
+ *
+ * Parameters        : none
+ *
+ * Return            : pointer to timer group object (timer group successfully created)
+ *   0               : timer group not created (not enough free memory)
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+tmg_t *tmg_create( void );
+
+__STATIC_INLINE
+tmg_t *tmg_new( void ) { return tmg_create(); }
+
+/******************************************************************************
+ *
+ * Name              : tmg_reset
+ * Alias             : tmg_kill
+ *
+ * Description       : stop the timer group, remove all member timers from the group
+ *                     and wake up all tasks waiting for them with 'E_STOPPED' event value
+ *
+ * Parameters
+ *   tmg             : pointer to timer group object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void tmg_reset( tmg_t *tmg );
+
+__STATIC_INLINE
+void tmg_kill( tmg_t *tmg ) { tmg_reset(tmg); }
+
+/******************************************************************************
+ *
+ * Name              : tmg_destroy
+ * Alias             : tmg_delete
+ *
+ * Description       : stop the timer group, remove all member timers from the group,
+ *                     wake up all tasks waiting for them with 'E_STOPPED' event value and free allocated resource
+ *
+ * Parameters
+ *   tmg             : pointer to timer group object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void tmg_destroy( tmg_t *tmg );
+
+__STATIC_INLINE
+void tmg_delete( tmg_t *tmg ) { tmg_destroy(tmg); }
+
+/******************************************************************************
+ *
+ * Name              : tmg_start
+ *
+ * Description       : start/restart the timer group for given duration of time
+ *                     when the timer group has finished the countdown, all member timers expire in order
+ *                     do this periodically if period > 0
+ *
+ * Parameters
+ *   tmg             : pointer to timer group object
+ *   delay           : duration of time (maximum number of ticks to countdown) for first expiration
+ *                     IMMEDIATE: don't countdown
+ *                     INFINITE:  countdown indefinitely
+ *   period          : duration of time (maximum number of ticks to countdown) for all next expirations
+ *                     IMMEDIATE: don't countdown
+ *                     INFINITE:  countdown indefinitely
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+void tmg_start( tmg_t *tmg, cnt_t delay, cnt_t period ) { tmr_start(&tmg->tmr, delay, period); }
+
+/******************************************************************************
+ *
+ * Name              : tmg_startPeriodic
+ *
+ * Description       : start/restart periodic timer group for given duration of time
+ *                     when the timer group has finished the countdown, all member timers expire in order
+ *                     do this periodically
+ *
+ * Parameters
+ *   tmg             : pointer to timer group object
+ *   period          : duration of time (maximum number of ticks to countdown)
+ *                     IMMEDIATE: don't countdown
+ *                     INFINITE:  countdown indefinitely
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+void tmg_startPeriodic( tmg_t *tmg, cnt_t period ) { tmr_start(&tmg->tmr, period, period); }
+
+/******************************************************************************
+ *
+ * Name              : tmg_insert
+ *
+ * Description       : add the timer to the end of the list of member timers
+ *                     the timer is stopped (or removed from other group) before
+ *
+ * Parameters
+ *   tmg             : pointer to timer group object
+ *   tmr             : pointer to timer object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     tmr_start, tmr_reset or tmr_destroy used for the member timer removes it from the group
+ *                     tmr_delayISR and deferred mode of the member timer have no effect
+ *
+ ******************************************************************************/
+
+void tmg_insert( tmg_t *tmg, tmr_t *tmr );
+
+/******************************************************************************
+ *
+ * Name              : tmg_remove
+ *
+ * Description       : remove the timer from the list of member timers
+ *                     and wake up all tasks waiting for it with 'E_STOPPED' event value
+ *
+ * Parameters
+ *   tmg             : pointer to timer group object
+ *   tmr             : pointer to timer object
+ *
+ * Return
+ *   E_SUCCESS       : timer was successfully removed from the group
+ *   E_FAILURE       : timer is not a member of the group
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+unsigned tmg_remove( tmg_t *tmg, tmr_t *tmr );
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+
+/******************************************************************************
+ *
+ * Class             : TimerGroup
+ *
+ * Description       : create and initialize a timer group object
+ *
+ * Constructor parameters
+ *                   : none
+ *
+ ******************************************************************************/
+
+struct TimerGroup : public __tmg
+{
+	 TimerGroup( void ): __tmg _TMG_INIT() {}
+	~TimerGroup( void ) { assert(__tmg::tmr.hdr.id == ID_STOPPED); }
+
+	static
+	TimerGroup *create( void )
+	{
+		static_assert(sizeof(__tmg) == sizeof(TimerGroup), "unexpected error!");
+		return reinterpret_cast<TimerGroup *>(tmg_create());
+	}
+
+	void     reset        ( void )                        {        tmg_reset        (this);                  }
+	void     kill         ( void )                        {        tmg_kill         (this);                  }
+	void     destroy      ( void )                        {        tmg_destroy      (this);                  }
+	void     start        ( cnt_t _delay, cnt_t _period ) {        tmg_start        (this, _delay, _period); }
+	void     startPeriodic( cnt_t _period )               {        tmg_startPeriodic(this, _period);         }
+	void     insert       ( tmr_t *_tmr )                 {        tmg_insert       (this, _tmr);            }
+	unsigned remove       ( tmr_t *_tmr )                 { return tmg_remove       (this, _tmr);            }
+
+	bool     operator!    ( void )                        { return __tmg::tmr.hdr.id == ID_STOPPED;          }
+};
+
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_TMG_H
@@ -30,21 +30,19 @@
  ******************************************************************************/
 
 #include "oskernel.h"
-#include "inc/oscriticalsection.h"
 
 /* -------------------------------------------------------------------------- */
 cnt_t sys_time( void )
 /* -------------------------------------------------------------------------- */
 {
-	cnt_t cnt;
-
-	sys_lock();
-	{
-		cnt = core_sys_time();
-	}
-	sys_unlock();
+	return core_sys_time();
+}
 
-	return cnt;
+/* -------------------------------------------------------------------------- */
+uint32_t sys_hrtime( void )
+/* -------------------------------------------------------------------------- */
+{
+	return core_sys_hrtime();
 }
 
 /* -------------------------------------------------------------------------- */
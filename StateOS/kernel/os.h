@@ -48,6 +48,7 @@
 #include "osalloc.h"
 #include "inc/oscriticalsection.h"
 #include "inc/osspinlock.h"
+#include "inc/ossequencelock.h"
 #include "inc/osonceflag.h"
 #include "inc/osevent.h"
 #include "inc/ossignal.h"
@@ -57,15 +58,24 @@
 #include "inc/osmutex.h"
 #include "inc/osfastmutex.h"
 #include "inc/osconditionvariable.h"
+#include "inc/osreaderwriterlock.h"
 #include "inc/oslist.h"
 #include "inc/osmemorypool.h"
 #include "inc/osstreambuffer.h"
 #include "inc/osmessagebuffer.h"
 #include "inc/osmailboxqueue.h"
+#include "inc/oschannel.h"
 #include "inc/oseventqueue.h"
 #include "inc/osjobqueue.h"
+#include "inc/osexecutor.h"
+#include "inc/osrpc.h"
 #include "inc/ostimer.h"
+#include "inc/ostimergroup.h"
+#include "inc/ostimeout.h"
 #include "inc/ostask.h"
+#include "inc/ospoll.h"
+#include "inc/osfutex.h"
+#include "inc/oscoroutine.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -101,6 +111,7 @@ void sys_init( void ) { port_sys_init(); }
  * Return            : current value of system counter
  *
  * Note              : may be used both in thread and handler mode
+ *                     interrupts are not disabled
  *
  ******************************************************************************/
 
@@ -109,6 +120,62 @@ cnt_t sys_time( void );
 __STATIC_INLINE
 cnt_t sys_timeISR( void ) { return sys_time(); }
 
+/******************************************************************************
+ *
+ * Name              : sys_hrtime
+ *
+ * Description       : return current value of high resolution system clock
+ *
+ * Parameters        : none
+ *
+ * Return            : number of microseconds since the system start (modulo 2^32)
+ *
+ * Note              : may be used both in thread and handler mode
+ *                     interrupts are not disabled
+ *                     tick mode: time elapsed since the last tick is read from the hardware tick counter
+ *                     tick-less mode: the system time is scaled to microseconds, so the resolution is the same
+ *                     as of sys_time (1/OS_FREQUENCY; microseconds only with OS_FREQUENCY of at least 1000000)
+ *
+ ******************************************************************************/
+
+uint32_t sys_hrtime( void );
+
+/******************************************************************************
+ *
+ * Name              : sys_wakeups
+ *
+ * Description       : return number of system timer wakeups (invocations of the timers queue handler)
+ *
+ * Parameters        : none
+ *
+ * Return            : number of system timer wakeups since the system start
+ *
+ * Note              : may be used both in thread and handler mode
+ *                     sample it periodically to get the number of wakeups per second
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+unsigned sys_wakeups( void ) { return System.wkp; }
+
+/******************************************************************************
+ *
+ * Name              : sys_expiries
+ *
+ * Description       : return peak number of timers and timeouts expired in one invocation of the timers queue handler
+ *
+ * Parameters        : none
+ *
+ * Return            : peak number of expirations handled in one system timer wakeup
+ *
+ * Note              : may be used both in thread and handler mode
+ *                     the value is limited by OS_TIMER_BUDGET (if greater than zero)
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+unsigned sys_expiries( void ) { return System.exp; }
+
 #ifdef __cplusplus
 }
 #endif
@@ -54,6 +54,30 @@ extern "C" {
 #define OS_TIMER_SIZE    32
 #endif
 
+#ifndef OS_TIMER_QUEUE
+#define OS_TIMER_QUEUE    0 /* deferred timer callbacks disabled */
+#endif
+
+#ifndef OS_TIMER_PRIO
+#define OS_TIMER_PRIO     UINT_MAX
+#endif
+
+#ifndef OS_TIMER_STACK
+#define OS_TIMER_STACK    OS_STACK_SIZE
+#endif
+
+#ifndef OS_TIMER_BUDGET
+#define OS_TIMER_BUDGET   0 /* no limit of expirations handled in one invocation of the timers queue handler */
+#endif
+
+#ifndef OS_EDF_PRIO
+#define OS_EDF_PRIO       0 /* earliest-deadline-first scheduling disabled */
+#endif
+
+#ifndef OS_FUTEX_QUEUES
+#define OS_FUTEX_QUEUES   8 /* number of wait queues in the futex hash table */
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 #if     OS_TIMER_SIZE == 16
@@ -75,13 +99,25 @@ typedef uint64_t     cnt_t;
 #error  HW_TIMER_SIZE > OS_TIMER_SIZE causes unexpected problems!
 #endif
 
+#if     OS_FUTEX_QUEUES <= 0
+#error  Invalid OS_FUTEX_QUEUES value!
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 typedef struct __mtx mtx_t, * const mtx_id;
+typedef struct __rwl rwl_t, * const rwl_id; // reader-writer lock
+typedef struct __rpc rpc_t, * const rpc_id; // remote procedure call
 typedef struct __tmr tmr_t, * const tmr_id; // timer
 typedef struct __tsk tsk_t, * const tsk_id; // task
+typedef struct __tmo tmo_t, * const tmo_id; // timeout
+typedef struct __prd prd_t;                 // periodic task record
+typedef struct __pol pol_t;                 // poller
+typedef struct __exe exe_t;                 // executor
+typedef struct __jbe jbe_t;                 // job queue entry
 typedef         void fun_t();               // timer/task procedure
 typedef         void act_t(unsigned);       // signal action
+typedef         void cbk_t(void *);         // timeout callback
 
 /* -------------------------------------------------------------------------- */
 
@@ -111,11 +147,12 @@ typedef enum __tid
 typedef struct __obj
 {
 	tsk_t  * queue; // next process in the BLOCKED queue
+	pol_t  * pol;   // list of pollers registered on the object
 	void   * res;   // allocated object's resource
 
 }	obj_t;
 
-#define               _OBJ_INIT() { 0, 0 }
+#define               _OBJ_INIT() { 0, 0, 0 }
 
 /* -------------------------------------------------------------------------- */
 
@@ -164,6 +201,13 @@ typedef struct __sys
 	tsk_t  * sig;   // queue of tasks waiting for a signal
 	tsk_t  * dly;   // queue of sleeping and suspended tasks
 	tsk_t  * des;   // queue of tasks waiting for destruction
+	volatile
+	unsigned lck;   // context switch lock; context switch is deferred while set
+	volatile
+	unsigned mtx;   // reordering of the list of mutexes held by the current task is deferred while set
+	unsigned wkp;   // number of timers queue handler invocations (system timer wakeups)
+	unsigned exp;   // maximum number of expirations handled in one invocation of the timers queue handler
+	tmr_t  * tmr;   // timer whose callback procedure is being launched
 
 }	sys_t;
 
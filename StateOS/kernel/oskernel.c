@@ -31,8 +31,12 @@
 
 #include "oskernel.h"
 #include "inc/ostimer.h"
+#include "inc/ostimeout.h"
 #include "inc/ostask.h"
 #include "inc/osmutex.h"
+#include "inc/osreaderwriterlock.h"
+#include "inc/osrpc.h"
+#include "inc/ospoll.h"
 
 /* -------------------------------------------------------------------------- */
 // SYSTEM INTERNAL SERVICES
@@ -120,9 +124,37 @@ void core_tmr_remove( tmr_t *tmr )
 
 #if HW_TIMER_SIZE
 
+static
+cnt_t priv_tmr_window( tmr_t *tmr )
+{
+	// return the latest time point (counted from the start of the timer 'tmr')
+	// that is within the slack window of 'tmr' and all timers expiring before it
+	tmr_t *nxt;
+	cnt_t  lim = tmr->delay + tmr->slack;
+	cnt_t  dly;
+
+	if (lim < tmr->delay)
+		lim = CNT_MAX;
+
+	for (nxt = tmr->hdr.next; nxt->delay != INFINITE; nxt = nxt->hdr.next)
+	{
+		dly = (cnt_t)(nxt->start + nxt->delay - tmr->start);
+		if (dly >= lim)
+			break;
+		if (nxt->slack < lim - dly)
+			lim = dly + nxt->slack;
+	}
+
+	return lim;
+}
+
+/* -------------------------------------------------------------------------- */
+
 static
 bool priv_tmr_expired( tmr_t *tmr )
 {
+	cnt_t lim;
+
 	port_tmr_stop();
 
 	if (tmr->delay == INFINITE)
@@ -131,9 +163,10 @@ bool priv_tmr_expired( tmr_t *tmr )
 	if (tmr->delay <= (cnt_t)(core_sys_time() - tmr->start))
 	return true;  // return if timer finished counting
 
-	port_tmr_start((cnt_t)(tmr->start + tmr->delay));
+	lim = priv_tmr_window(tmr);
+	port_tmr_start((cnt_t)(tmr->start + lim));
 
-	if (tmr->delay >  (cnt_t)(core_sys_time() - tmr->start))
+	if (lim >  (cnt_t)(core_sys_time() - tmr->start))
 	return false; // return if timer still counts
 
 	port_tmr_stop();
@@ -158,31 +191,265 @@ bool priv_tmr_expired( tmr_t *tmr )
 
 /* -------------------------------------------------------------------------- */
 
+#if OS_TIMER_QUEUE > 0
+
+static  tmr_t  * TMR_QUE[OS_TIMER_QUEUE + 1]; // queue of deferred timers
+static  unsigned TMR_HEAD;                    // written only with interrupts masked (timers queue handler, timer group handler)
+static  unsigned TMR_TAIL;                    // written only by the timer service task
+static  tsk_t  * TMR_WAIT;                    // timer service task waiting for deferred timers
+static  stk_t    TMR_STK[STK_SIZE(OS_TIMER_STACK)];
+
 static
-void priv_tmr_wakeup( tmr_t *tmr, unsigned event )
+void priv_tmr_service( void )
+{
+	tmr_t *tmr;
+	fun_t *state;
+
+	for (;;)
+	{
+		port_set_lock();
+		{
+			while (TMR_TAIL == TMR_HEAD)
+				core_tsk_waitFor(&TMR_WAIT, INFINITE);
+
+			tmr = TMR_QUE[TMR_TAIL];
+			TMR_TAIL = TMR_TAIL < OS_TIMER_QUEUE ? TMR_TAIL + 1 : 0;
+			state = 0;
+
+			if (tmr)
+			{
+				tmr->pend = false;
+				state = tmr->state;
+				System.tmr = tmr;
+			}
+		}
+		port_clr_lock();
+
+		if (state)
+			state();
+	}
+}
+
+static  tsk_t    TMR_TSK = _TSK_INIT(OS_TIMER_PRIO, priv_tmr_service, TMR_STK, sizeof(TMR_STK)); // timer service task
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tmr_defer( tmr_t *tmr )
+{
+	unsigned head = TMR_HEAD;
+	unsigned next = head < OS_TIMER_QUEUE ? head + 1 : 0;
+
+	if (tmr->pend || next == TMR_TAIL)
+	{
+		tmr->overrun++;
+		return;
+	}
+
+	tmr->pend = true;
+	TMR_QUE[head] = tmr;
+	TMR_HEAD = next;
+
+	if (TMR_TSK.hdr.id == ID_STOPPED)
+	{
+		core_ctx_init(&TMR_TSK);
+		core_tsk_insert(&TMR_TSK);
+	}
+	else
+	if (TMR_WAIT)
+		core_one_wakeup(TMR_WAIT, E_SUCCESS);
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tmr_cancel( tmr_t *tmr )
+{
+	unsigned i;
+
+	if (tmr->pend)
+	{
+		for (i = TMR_TAIL; i != TMR_HEAD; i = i < OS_TIMER_QUEUE ? i + 1 : 0)
+			if (TMR_QUE[i] == tmr)
+				TMR_QUE[i] = 0;
+
+		tmr->pend = false;
+	}
+}
+
+#endif//OS_TIMER_QUEUE
+
+/* -------------------------------------------------------------------------- */
+
+void core_tmr_launch( tmr_t *tmr )
 {
+#if OS_TIMER_QUEUE > 0
+	if (tmr->defer)
+		priv_tmr_defer(tmr);
+	else
+#endif
 	if (tmr->state)
+	{
+		System.tmr = tmr;
 		tmr->state();
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tmr_reset( tmr_t *tmr, unsigned event )
+{
+	if (tmr->hdr.id == ID_TIMER)
+	{
+		core_all_wakeup(tmr->hdr.obj.queue, event);
+		core_pol_notify(&tmr->hdr.obj);
+		core_tmr_remove(tmr);
+	}
+#if OS_TIMER_QUEUE > 0
+	core_tmr_cancel(tmr);
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tmr_wakeup( tmr_t *tmr, unsigned event )
+{
+	core_tmr_launch(tmr);
 
 	priv_tmr_remove(tmr);
 	if (tmr->delay >= (cnt_t)(core_sys_time() - tmr->start + 1))
 		priv_tmr_insert(tmr);
 
 	core_all_wakeup(tmr->hdr.obj.queue, event);
+	core_pol_notify(&tmr->hdr.obj);
+}
+
+/* -------------------------------------------------------------------------- */
+// SYSTEM TIMEOUT SERVICES
+/* -------------------------------------------------------------------------- */
+
+static  tmo_t TMO     = { .prev=&TMO, .next=&TMO }; // timeouts queue
+static  tmr_t TMO_TMR = { .hdr={ .id=ID_STOPPED } }; // the only entry of timeouts queue in the timers queue
+
+static
+bool priv_tmo_expired( tmo_t *tmo )
+{
+	return (cnt_t)(core_sys_time() - tmo->time) <= ((CNT_MAX)>>1);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tmo_update( void )
+{
+	tmo_t *tmo = TMO.next;
+
+	if (TMO_TMR.hdr.id == ID_TIMER)
+		priv_tmr_remove(&TMO_TMR);
+
+	if (tmo != &TMO)
+	{
+		TMO_TMR.start = core_sys_time();
+		TMO_TMR.delay = tmo->time - TMO_TMR.start;
+		if (TMO_TMR.delay > ((CNT_MAX)>>1))
+			TMO_TMR.delay = 0; // timeout has already expired
+		priv_tmr_insert(&TMO_TMR);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tmo_insert( tmo_t *tmo )
+{
+	tmo_t *nxt = TMO.next;
+	tmo_t *prv;
+
+	while (nxt != &TMO && (cnt_t)(tmo->time - nxt->time) <= ((CNT_MAX)>>1))
+		nxt = nxt->next;
+
+	prv = nxt->prev;
+	tmo->prev = prv;
+	tmo->next = nxt;
+	nxt->prev = tmo;
+	prv->next = tmo;
+
+	if (TMO.next == tmo)
+	{
+		priv_tmo_update();
+		port_tmr_force();
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tmo_remove( tmo_t *tmo )
+{
+	tmo_t *nxt = tmo->next;
+	tmo_t *prv = tmo->prev;
+
+	nxt->prev = prv;
+	prv->next = nxt;
+	tmo->next = 0; // timeout is not armed
+}
+
+/* -------------------------------------------------------------------------- */
+
+// handle expired timeouts; each of them is charged against the budget of the timers queue handler
+// 'cnt' is the number of expirations already handled in the current invocation of the timers queue handler
+// return the updated number of handled expirations
+static
+unsigned priv_tmo_handler( unsigned cnt )
+{
+	tmo_t *tmo;
+
+	while ((tmo = TMO.next) != &TMO && priv_tmo_expired(tmo))
+	{
+#if OS_TIMER_BUDGET > 0
+		if (cnt == OS_TIMER_BUDGET)
+			break; // TMO_TMR is rearmed with zero delay, so the rest of expired timeouts will be handled in the next invocation
+#endif
+		cnt++;
+
+		core_tmo_remove(tmo);
+		if (tmo->fun)
+			tmo->fun(tmo->arg);
+	}
+
+	priv_tmo_update();
+
+	return cnt;
 }
 
 /* -------------------------------------------------------------------------- */
 
 void core_tmr_handler( void )
 {
-	tmr_t *tmr;
+	tmr_t  * tmr;
+	tmr_t  * cur = System.tmr; // the timer service task may be preempted while launching a callback procedure
+	unsigned cnt = 0;
 
 	port_set_lock();
 	{
+		System.wkp++;
+
 		while (priv_tmr_expired(tmr = WAIT.hdr.next))
 		{
+#if OS_TIMER_BUDGET > 0
+			if (cnt == OS_TIMER_BUDGET)
+			{
+				port_tmr_force(); // the rest of expired timers will be handled in the next invocation
+				break;
+			}
+#endif
+			cnt++;
+
 			tmr->start += tmr->delay;
 
+			if (tmr == &TMO_TMR)
+			{
+				cnt = priv_tmo_handler(cnt - 1); // the proxy itself is not charged
+			}
+			else
 			if (tmr->hdr.id == ID_TIMER)
 			{
 				tmr->delay = tmr->period;
@@ -194,6 +461,11 @@ void core_tmr_handler( void )
 				core_tsk_wakeup((tsk_t *)tmr, E_TIMEOUT);
 			}
 		}
+
+		if (System.exp < cnt)
+			System.exp = cnt;
+
+		System.tmr = cur;
 	}
 	port_clr_lock();
 }
@@ -219,6 +491,29 @@ sys_t System = { .cur=&MAIN };
 
 /* -------------------------------------------------------------------------- */
 
+#if OS_EDF_PRIO
+
+// return true if task 'tsk' belongs to the EDF band and its deadline is earlier than deadline of task 'nxt' of the same priority
+static
+bool priv_tsk_earlier( tsk_t *tsk, tsk_t *nxt )
+{
+	return tsk->prio == OS_EDF_PRIO && (cnt_t)(nxt->deadline - tsk->deadline - 1) < ((CNT_MAX)>>1);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+// return true if task 'tsk' is a basic task with a live frame on the shared stack
+// such a task keeps the head of its priority band, so no other basic task of the same priority can overwrite its frame
+static
+bool priv_tsk_started( tsk_t *tsk )
+{
+	return tsk->act && tsk->sp != (void *)STK_CROP(tsk->stack, tsk->size);
+}
+
+/* -------------------------------------------------------------------------- */
+
 static
 void priv_tsk_insert( tsk_t *tsk )
 {
@@ -228,7 +523,11 @@ void priv_tsk_insert( tsk_t *tsk )
 #endif
 	if (tsk->prio)
 		do nxt = nxt->hdr.next;
-		while (tsk->prio <= nxt->prio);
+#if OS_EDF_PRIO
+		while (tsk->prio < nxt->prio || (tsk->prio == nxt->prio && !priv_tsk_started(tsk) && !priv_tsk_earlier(tsk, nxt)));
+#else
+		while (tsk->prio < nxt->prio || (tsk->prio == nxt->prio && !priv_tsk_started(tsk)));
+#endif
 
 	priv_rdy_insert(&tsk->hdr, &nxt->hdr);
 }
@@ -265,6 +564,12 @@ void core_tsk_remove( tsk_t *tsk )
 
 void core_ctx_init( tsk_t *tsk )
 {
+	if (tsk->act)
+	{
+		// basic task: context is built on the shared stack when the task is dispatched
+		tsk->sp = (void *)STK_CROP(tsk->stack, tsk->size);
+		return;
+	}
 #ifdef DEBUG
 	if (tsk != System.cur)
 		memset(tsk->stack, 0xFF, tsk->size);
@@ -286,6 +591,27 @@ void core_ctx_switch( void )
 
 /* -------------------------------------------------------------------------- */
 
+static
+void priv_tsk_complete( tsk_t *tsk )
+{
+	// the basic task has run to completion; its frame on the shared stack is abandoned
+	tsk->sp = (void *)STK_CROP(tsk->stack, tsk->size);
+	priv_tsk_remove(tsk);
+	if (tsk->act > 1)
+	{
+		// pending activation: run again after the tasks of the same priority
+		tsk->act--;
+		priv_tsk_insert(tsk);
+	}
+	else
+	{
+		tsk->hdr.id = ID_STOPPED;
+	}
+	priv_ctx_switchNow();
+}
+
+/* -------------------------------------------------------------------------- */
+
 void core_tsk_loop( void )
 {
 	for (;;)
@@ -293,15 +619,178 @@ void core_tsk_loop( void )
 		port_clr_lock();
 		System.cur->state();
 		port_set_lock();
-		core_ctx_switch();
+		if (System.cur->act)
+			priv_tsk_complete(System.cur);
+		else
+			core_ctx_switch();
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_pol_unlink( tsk_t *tsk )
+{
+	pol_t *pol = tsk->tmp.pol.list;
+	unsigned count = tsk->tmp.pol.count;
+
+	for (tsk->tmp.pol.count = 0; count > 0; count--, pol++)
+	{
+		if (pol->next)
+			pol->next->back = pol->back;
+		*pol->back = pol->next;
 	}
 }
 
 /* -------------------------------------------------------------------------- */
 
+// return priority inherited from the mutex 'mtx' by its owner
+static
+unsigned priv_mtx_prio( mtx_t *mtx )
+{
+	unsigned prio = 0;
+
+	if ((mtx->mode & mtxPrioMASK) == mtxPrioCeiling)
+		prio = mtx->prio;
+
+	if ((mtx->mode & mtxPrioMASK) != mtxPrioNone && mtx->obj.queue)
+		if (prio < mtx->obj.queue->prio)
+			prio = mtx->obj.queue->prio;
+
+	return prio;
+}
+
+/* -------------------------------------------------------------------------- */
+
+// insert the mutex 'mtx' into the list of mutexes held by the task 'tsk'
+// the list is ordered by inherited priority, so its head alone determines the priority of the owner
+static
+void priv_mtx_insert( mtx_t *mtx, tsk_t *tsk )
+{
+	mtx_t  **lst = &tsk->mtx.list;
+	unsigned prio = priv_mtx_prio(mtx);
+
+	while (*lst && prio < priv_mtx_prio(*lst))
+		lst = &(*lst)->list;
+
+	mtx->list = *lst;
+	if (mtx->list)
+		mtx->list->back = &mtx->list;
+	mtx->back = lst;
+	*lst = mtx;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_mtx_remove( mtx_t *mtx )
+{
+	if (mtx->list)
+		mtx->list->back = mtx->back;
+	*mtx->back = mtx->list;
+
+	mtx->list = 0;
+	mtx->back = 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+// inherited priority of the mutex 'mtx' has changed; restore the order of the list of mutexes held by the owner
+static
+void priv_mtx_update( mtx_t *mtx )
+{
+	tsk_t *tsk = mtx->owner;
+
+	if (tsk && (mtx->mode & mtxPrioMASK) != mtxPrioNone)
+	{
+		if (tsk == System.cur && System.lck) // the owner may be changing the list on the uncontended fast path
+		{
+			System.mtx = 1;                  // leave the reordering to core_ctx_unlock
+			return;
+		}
+
+		priv_mtx_remove(mtx);
+		priv_mtx_insert(mtx, tsk);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+// restore the order of the whole list of mutexes held by the task 'tsk'
+static
+void priv_mtx_sort( tsk_t *tsk )
+{
+	mtx_t *mtx = tsk->mtx.list;
+	mtx_t *nxt;
+
+	for (tsk->mtx.list = 0; mtx; mtx = nxt)
+	{
+		nxt = mtx->list;
+		priv_mtx_insert(mtx, tsk);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_ctx_unlock( void )
+{
+	lck_t lck;
+
+	port_set_sync();
+	System.lck = 0;
+	port_set_sync();
+
+	// an interrupt has deferred the reordering of the list of mutexes held by the current task
+	if (System.mtx)
+	{
+		lck = port_get_lock();
+		port_set_lock();
+		{
+			System.mtx = 0;
+			priv_mtx_sort(System.cur);
+		}
+		port_put_lock(lck);
+	}
+
+	if (IDLE.hdr.next != System.cur)
+		port_ctx_switch();
+}
+
+/* -------------------------------------------------------------------------- */
+
+// return priority inherited through the reader-writer lock 'rwl' by its writer
+static
+unsigned priv_rwl_prio( rwl_t *rwl )
+{
+	unsigned prio = 0;
+
+	if ((rwl->mode & rwlPrioMASK) == rwlPrioInherit)
+	{
+		if (rwl->obj.queue && prio < rwl->obj.queue->prio)
+			prio = rwl->obj.queue->prio;
+
+		if (rwl->queue && prio < rwl->queue->prio)
+			prio = rwl->queue->prio;
+	}
+
+	return prio;
+}
+
+/* -------------------------------------------------------------------------- */
+
+// return priority lent through the remote procedure call 'rpc' by its client
+static
+unsigned priv_rpc_prio( rpc_t *rpc )
+{
+	return rpc->client ? rpc->client->prio : 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
 void core_tsk_append( tsk_t *tsk, tsk_t **que )
 {
 	tsk_t *nxt = *que;
+	mtx_t *mtx;
 	tsk->guard  = que;
 	tsk->hdr.id = ID_READY;
 
@@ -316,27 +805,51 @@ void core_tsk_append( tsk_t *tsk, tsk_t **que )
 	tsk->back = que;
 	tsk->hdr.obj.queue = nxt;
 	*que = tsk;
+
+	mtx = tsk->mtx.tree;
+	if (mtx && que == &mtx->obj.queue) // new head of the queue of tasks waiting for the mutex
+	{
+		priv_mtx_update(mtx);
+		if ((mtx->mode & mtxPrioMASK) != mtxPrioNone && mtx->owner && mtx->owner->prio < tsk->prio)
+			core_tsk_prio(mtx->owner, tsk->prio);
+	}
 }
 
 /* -------------------------------------------------------------------------- */
 
-void core_tsk_unlink( tsk_t *tsk, unsigned event )
+static
+void priv_tsk_unlink( tsk_t *tsk, unsigned event )
 {
 	tsk_t**que = tsk->back;
 	tsk_t *nxt = tsk->hdr.obj.queue;
+	mtx_t *mtx = tsk->mtx.tree;
+
 	tsk->event = event;
 	tsk->guard = 0;
 
 	if (nxt)
 		nxt->back = que;
 	*que = nxt;
+
+	if (mtx && que == &mtx->obj.queue) // head of the queue of tasks waiting for the mutex has been removed
+		priv_mtx_update(mtx);
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tsk_unlink( tsk_t *tsk, unsigned event )
+{
+	if (tsk->guard == &tsk->tmp.pol.queue) // polling task
+		priv_pol_unlink(tsk);
+
+	priv_tsk_unlink(tsk, event);
 }
 
 /* -------------------------------------------------------------------------- */
 
 void core_tsk_transfer( tsk_t *tsk, tsk_t **que )
 {
-	core_tsk_unlink(tsk, tsk->event);
+	priv_tsk_unlink(tsk, tsk->event); // the task is still waiting; a polling task keeps its pollers linked
 	core_tsk_append(tsk, que);
 }
 
@@ -428,6 +941,40 @@ tsk_t *core_tsk_wakeup( tsk_t *tsk, unsigned event )
 
 /* -------------------------------------------------------------------------- */
 
+void core_tsk_handoff( tsk_t *tsk, unsigned event )
+{
+	tsk_t *cur = System.cur;
+	tsk_t *nxt = cur->hdr.next;
+
+	core_tsk_unlink(tsk, event);
+	priv_tmr_remove((tmr_t *)tsk);
+
+	// the dispatcher always takes the head of tasks READY queue, so putting the resumed task
+	// in front of the current task makes it the next one to run without searching its priority band
+	if (cur != IDLE.hdr.next || cur->act || tsk->act || tsk->prio < cur->prio || tsk->prio < nxt->prio)
+	{
+		core_tsk_insert(tsk);
+		return;
+	}
+
+	tsk->hdr.id = ID_READY;
+#if OS_ROBIN && HW_TIMER_SIZE == 0
+	tsk->slice = 0;
+#endif
+	priv_rdy_insert(&tsk->hdr, &cur->hdr);
+
+	// the current task is no longer at the head, so the dispatcher won't reorder it
+	if (cur->prio < nxt->prio)
+	{
+		priv_tsk_remove(cur);
+		priv_tsk_insert(cur);
+	}
+
+	port_ctx_switch();
+}
+
+/* -------------------------------------------------------------------------- */
+
 void core_all_wakeup( tsk_t *tsk, unsigned event )
 {
 	while (tsk = core_tsk_wakeup(tsk, event), tsk) tsk = tsk->hdr.obj.queue;
@@ -446,17 +993,38 @@ unsigned core_tsk_count( tsk_t *tsk )
 
 /* -------------------------------------------------------------------------- */
 
-void core_tsk_prio( tsk_t *tsk, unsigned prio )
+// return the effective priority of the task 'tsk': the greatest of 'prio', the basic priority
+// and priorities inherited through the objects held by the task
+static
+unsigned priv_tsk_prio( tsk_t *tsk, unsigned prio )
 {
-	mtx_t *mtx;
+	mtx_t *mtx = tsk->mtx.list; // mutex with the highest inherited priority
+	rwl_t *rwl;
+	rpc_t *rpc;
 
 	if (prio < tsk->basic)
 		prio = tsk->basic;
 
-	for (mtx = tsk->mtx.list; mtx; mtx = mtx->list)
-		if ((mtx->mode & mtxPrioMASK) != mtxPrioNone && mtx->obj.queue)
-			if (prio < mtx->obj.queue->prio)
-				prio = mtx->obj.queue->prio;
+	if (mtx && prio < priv_mtx_prio(mtx))
+		prio = priv_mtx_prio(mtx);
+
+	// a task rarely holds more than one reader-writer lock for writing, so the list is not ordered
+	for (rwl = tsk->rwl.list; rwl; rwl = rwl->list)
+		if (prio < priv_rwl_prio(rwl))
+			prio = priv_rwl_prio(rwl);
+
+	for (rpc = tsk->rpc.list; rpc; rpc = rpc->list)
+		if (prio < priv_rpc_prio(rpc))
+			prio = priv_rpc_prio(rpc);
+
+	return prio;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tsk_prio( tsk_t *tsk, unsigned prio )
+{
+	prio = priv_tsk_prio(tsk, prio);
 
 	if (tsk->prio != prio)
 	{
@@ -471,9 +1039,7 @@ void core_tsk_prio( tsk_t *tsk, unsigned prio )
 		else
 		if (tsk->guard != 0)         // blocked task
 		{
-			core_tsk_transfer(tsk, tsk->guard);
-			if (tsk->mtx.tree)
-				core_tsk_prio(tsk->mtx.tree->owner, prio);
+			core_tsk_transfer(tsk, tsk->guard); // also propagates the priority to the owner of the mutex the task is waiting for
 		}
 		else
 		if (tsk->hdr.id == ID_READY) // ready task
@@ -488,16 +1054,9 @@ void core_tsk_prio( tsk_t *tsk, unsigned prio )
 
 void core_cur_prio( unsigned prio )
 {
-	mtx_t *mtx;
 	tsk_t *tsk = System.cur;
 
-	if (prio < tsk->basic)
-		prio = tsk->basic;
-
-	for (mtx = tsk->mtx.list; mtx; mtx = mtx->list)
-		if ((mtx->mode & mtxPrioMASK) != mtxPrioNone && mtx->obj.queue)
-			if (prio < mtx->obj.queue->prio)
-				prio = mtx->obj.queue->prio;
+	prio = priv_tsk_prio(tsk, prio);
 
 	if (tsk->prio != prio)
 	{
@@ -526,6 +1085,9 @@ void *core_tsk_handler( void *sp )
 
 		nxt = IDLE.hdr.next;
 
+		if (System.lck)
+			nxt = cur;
+		else
 #if OS_ROBIN && HW_TIMER_SIZE == 0
 		if (cur == nxt || (nxt->slice >= (OS_FREQUENCY)/(OS_ROBIN) && (nxt->slice = 0) == 0))
 #else
@@ -543,6 +1105,13 @@ void *core_tsk_handler( void *sp )
 
 		sp = nxt->sp;
 		nxt->sp = 0;
+
+		if (nxt->act && sp == (void *)STK_CROP(nxt->stack, nxt->size))
+		{
+			// basic task: build a fresh context on the top of the shared stack
+			sp = (ctx_t *)sp - 1;
+			port_ctx_init(sp, core_tsk_loop);
+		}
 	}
 	port_clr_lock();
 
@@ -553,16 +1122,48 @@ void *core_tsk_handler( void *sp )
 // SYSTEM MUTEX SERVICES
 /* -------------------------------------------------------------------------- */
 
+static
+void priv_cur_raise( unsigned prio )
+{
+	tsk_t *cur = System.cur;
+	lck_t  lck = port_get_lock();
+
+	// immediate priority ceiling: the running task only has to keep the head of the ready queue
+	port_set_lock();
+	{
+		cur->prio = prio;
+
+		if (cur != IDLE.hdr.next) // a task has been readied while the context switch was locked
+		{
+			priv_tsk_remove(cur);
+			priv_tsk_insert(cur);
+		}
+	}
+	port_put_lock(lck);
+}
+
+/* -------------------------------------------------------------------------- */
+
 void core_mtx_link( mtx_t *mtx, tsk_t *tsk )
 {
+	unsigned prio;
+
 	assert(mtx);
 
 	mtx->owner = tsk;
 
 	if (tsk)
 	{
-		mtx->list = tsk->mtx.list;
-		tsk->mtx.list = mtx;
+		priv_mtx_insert(mtx, tsk);
+
+		prio = priv_mtx_prio(mtx);
+		if (tsk->prio < prio)
+		{
+			if (tsk == System.cur)
+				priv_cur_raise(prio);
+			else
+				core_tsk_prio(tsk, prio);
+		}
 	}
 }
 
@@ -571,7 +1172,6 @@ void core_mtx_link( mtx_t *mtx, tsk_t *tsk )
 void core_mtx_unlink( mtx_t *mtx )
 {
 	tsk_t *tsk;
-	mtx_t *lst;
 
 	assert(mtx);
 
@@ -579,14 +1179,8 @@ void core_mtx_unlink( mtx_t *mtx )
 
 	if (tsk)
 	{
-		if (tsk->mtx.list == mtx)
-			tsk->mtx.list = mtx->list;
-
-		for (lst = tsk->mtx.list; lst; lst = lst->list)
-			if (lst->list == mtx)
-				lst->list = mtx->list;
+		priv_mtx_remove(mtx);
 
-		mtx->list  = 0;
 		mtx->owner = 0;
 		mtx->count = 0;
 
@@ -596,6 +1190,21 @@ void core_mtx_unlink( mtx_t *mtx )
 
 /* -------------------------------------------------------------------------- */
 
+void core_mtx_prio( mtx_t *mtx, unsigned prio )
+{
+	tsk_t *tsk = mtx->owner;
+
+	mtx->prio = prio;
+
+	if (tsk && (mtx->mode & mtxPrioMASK) == mtxPrioCeiling)
+	{
+		priv_mtx_update(mtx);
+		core_tsk_prio(tsk, tsk->basic);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
 tsk_t *core_mtx_transferLock( mtx_t *mtx, unsigned event )
 {
 	tsk_t *tsk;
@@ -615,6 +1224,131 @@ void core_mtx_reset( mtx_t *mtx, unsigned event )
 	core_all_wakeup(mtx->obj.queue, event);
 }
 
+/* -------------------------------------------------------------------------- */
+// SYSTEM READER-WRITER LOCK SERVICES
+/* -------------------------------------------------------------------------- */
+
+void core_rwl_link( rwl_t *rwl, tsk_t *tsk )
+{
+	assert(rwl);
+
+	rwl->owner = tsk;
+
+	if (tsk)
+	{
+		rwl->list = tsk->rwl.list;
+		if (rwl->list)
+			rwl->list->back = &rwl->list;
+		rwl->back = &tsk->rwl.list;
+		tsk->rwl.list = rwl;
+
+		core_tsk_prio(tsk, tsk->prio);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_rwl_unlink( rwl_t *rwl )
+{
+	tsk_t *tsk;
+
+	assert(rwl);
+
+	tsk = rwl->owner;
+
+	if (tsk)
+	{
+		if (rwl->list)
+			rwl->list->back = rwl->back;
+		*rwl->back = rwl->list;
+
+		rwl->list  = 0;
+		rwl->back  = 0;
+		rwl->owner = 0;
+
+		core_tsk_prio(tsk, tsk->basic);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+// SYSTEM REMOTE PROCEDURE CALL SERVICES
+/* -------------------------------------------------------------------------- */
+
+void core_rpc_link( rpc_t *rpc, tsk_t *tsk )
+{
+	assert(rpc);
+	assert(tsk);
+	assert(rpc->owner == 0);
+
+	rpc->owner = tsk;
+	rpc->list = tsk->rpc.list;
+	if (rpc->list)
+		rpc->list->back = &rpc->list;
+	rpc->back = &tsk->rpc.list;
+	tsk->rpc.list = rpc;
+
+	core_tsk_prio(tsk, tsk->prio);
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_rpc_unlink( rpc_t *rpc )
+{
+	tsk_t *tsk;
+
+	assert(rpc);
+
+	tsk = rpc->owner;
+
+	if (tsk)
+	{
+		if (rpc->list)
+			rpc->list->back = rpc->back;
+		*rpc->back = rpc->list;
+
+		rpc->list  = 0;
+		rpc->back  = 0;
+		rpc->owner = 0;
+
+		core_tsk_prio(tsk, tsk->basic);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+// SYSTEM POLL SERVICES
+/* -------------------------------------------------------------------------- */
+
+void core_pol_link( pol_t *list, unsigned count )
+{
+	tsk_t *cur = System.cur;
+	obj_t *obj;
+	pol_t *pol;
+
+	cur->tmp.pol.list  = list;
+	cur->tmp.pol.count = count;
+	cur->tmp.pol.queue = 0;
+
+	for (pol = list; count > 0; count--, pol++)
+	{
+		obj = pol->obj;
+		pol->owner = cur;
+		pol->next  = obj->pol;
+		if (pol->next)
+			pol->next->back = &pol->next;
+		pol->back  = &obj->pol;
+		obj->pol   = pol;
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_pol_wakeup( pol_t *pol )
+{
+	tsk_t *tsk = pol->owner;
+
+	core_tsk_wakeup(tsk, (unsigned)(pol - tsk->tmp.pol.list));
+}
+
 /* -------------------------------------------------------------------------- */
 // OTHER SYSTEM SERVICES
 /* -------------------------------------------------------------------------- */
@@ -41,10 +41,48 @@
 #ifdef  __cplusplus
 
 #if OS_FUNCTIONAL
-#include <functional>
-typedef std::function<void( void )>     FUN_t;
+#include <new>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// allocation-free inline callable object (delegate) of fixed size: OS_FUNCTIONAL pointers
+// the first pointer is the call thunk, the callable object is stored inline in the rest of the delegate
+// the delegate is trivially copyable, because the kernel objects (tasks, timers, job queues) copy it as raw bytes
+template<class>
+struct Delegate;
+
+template<class R, class... A>
+struct Delegate<R( A... )>
+{
+	Delegate( void ): fun_(nullptr), data_() {}
+	Delegate( std::nullptr_t ): fun_(nullptr), data_() {}
+
+	template<class F, class = typename std::enable_if<!std::is_same<F, Delegate>::value>::type,
+	                  class = decltype(std::declval<F&>()(std::declval<A>()...))>
+	Delegate( F _fun ): fun_(call_<F>), data_()
+	{
+		static_assert(sizeof(F) <= sizeof(data_), "callable object does not fit in the delegate (increase OS_FUNCTIONAL)!");
+		static_assert(alignof(F) <= alignof(void *), "callable object is overaligned!");
+		static_assert(std::is_trivially_copyable<F>::value, "callable object must be trivially copyable!");
+		new (data_) F(_fun);
+	}
+
+	R operator()( A... _args ) const { return fun_(const_cast<void **>(data_), _args...); }
+	explicit operator bool( void ) const { return fun_ != nullptr; }
+
+	private:
+	template<class F>
+	static R call_( void *_data, A... _args ) { return (*reinterpret_cast<F *>(_data))(_args...); }
+
+	R   (* fun_)( void *, A... );
+	void * data_[ OS_FUNCTIONAL - 1 ];
+};
+
+typedef Delegate<void( void )>     FUN_t;
 static_assert(sizeof(FUN_t) == sizeof(void*)*(OS_FUNCTIONAL), "incorrect value of OS_FUNCTIONAL constant!");
-typedef std::function<void( unsigned )> ACT_t;
+static_assert(std::is_trivially_copyable<FUN_t>::value, "unexpected error!");
+typedef Delegate<void( unsigned )> ACT_t;
 static_assert(sizeof(ACT_t) == sizeof(void*)*(OS_FUNCTIONAL), "incorrect value of OS_FUNCTIONAL constant!");
 #else
 typedef     void (* FUN_t)( void );
@@ -134,6 +172,16 @@ void core_ctx_reset( void )
 	port_ctx_reset();
 }
 
+// lock context switch for the current process; interrupts are not disabled
+__STATIC_INLINE
+void core_ctx_lock( void )
+{
+	System.lck = 1; port_set_sync();
+}
+
+// unlock context switch for the current process and perform the deferred context switch
+void core_ctx_unlock( void );
+
 /* -------------------------------------------------------------------------- */
 
 // insert task / timer 'tmr' into timers READY queue
@@ -145,6 +193,25 @@ void core_tmr_remove( tmr_t *tmr );
 // timers queue handler procedure
 void core_tmr_handler( void );
 
+#if OS_TIMER_QUEUE > 0
+// remove deferred timer 'tmr' from the queue of the timer service task
+void core_tmr_cancel( tmr_t *tmr );
+#endif
+
+// launch the callback procedure of the expired timer 'tmr', directly or through the timer service task (deferred timer)
+void core_tmr_launch( tmr_t *tmr );
+
+// stop the timer 'tmr', release all tasks waiting for it with event 'event' and cancel its deferred callback
+void core_tmr_reset( tmr_t *tmr, unsigned event );
+
+/* -------------------------------------------------------------------------- */
+
+// insert timeout 'tmo' into timeouts queue
+void core_tmo_insert( tmo_t *tmo );
+
+// remove timeout 'tmo' from timeouts queue
+void core_tmo_remove( tmo_t *tmo );
+
 /* -------------------------------------------------------------------------- */
 
 // reset stack and restart the current task
@@ -162,9 +229,10 @@ void core_tsk_remove( tsk_t *tsk );
 void core_tsk_append( tsk_t *tsk, tsk_t **obj );
 
 // remove task 'tsk' from the blocked queue with event value 'event'
+// pollers of a polling task are unlinked as well
 void core_tsk_unlink( tsk_t *tsk, unsigned event );
 
-// transfer task 'tsk' to the blocked queue 'que'
+// transfer task 'tsk' to the blocked queue 'que'; the task keeps waiting, so pollers of a polling task stay linked
 void core_tsk_transfer( tsk_t *tsk, tsk_t **que );
 
 // delay execution of current task for given duration of time 'delay'
@@ -214,6 +282,14 @@ void core_tsk_suspend( tsk_t *tsk );
 // return 'tsk'
 tsk_t *core_tsk_wakeup( tsk_t *tsk, unsigned event );
 
+// resume execution of blocked task 'tsk' with event value 'event' and hand the processor over to it directly
+// remove resumed task from guard object blocked queue
+// remove resumed task from timers READY queue
+// if priority of resumed task is not lower then priority of any ready task, insert it at the head of tasks READY queue (in front of the current task)
+// otherwise insert resumed task into tasks READY queue as core_tsk_wakeup does
+// force context switch to the resumed task
+void core_tsk_handoff( tsk_t *tsk, unsigned event );
+
 // resume execution of first task from blocked queue with event value 'event'; 'tsk' is the head (first task) of the queue
 // remove resumed task from guard object blocked queue
 // remove resumed task from timers READY queue
@@ -253,11 +329,17 @@ void *core_tsk_handler( void *sp );
 /* -------------------------------------------------------------------------- */
 
 // set the task 'tsk' as the owner of the mutex 'mtx'
+// safe to call for the current task with the context switch locked only; an interrupt does not reorder
+// the list of mutexes held by the current task then, but leaves it to core_ctx_unlock
 void core_mtx_link( mtx_t *mtx, tsk_t *tsk );
 
 // remove owner of the mutex 'mtx'
+// safe to call for the current task with the context switch locked only (see core_mtx_link)
 void core_mtx_unlink( mtx_t *mtx );
 
+// set priority of the mutex 'mtx' and update priority of its owner
+void core_mtx_prio( mtx_t *mtx, unsigned prio );
+
 // transfer lock to the next task in the blocked queue of mutex 'mtx'
 // the task is waked with event 'event'
 // return pointer to the waked task or 0 if the blocked queue of 'mtx' is empty
@@ -268,22 +350,122 @@ void core_mtx_reset( mtx_t *mtx, unsigned event );
 
 /* -------------------------------------------------------------------------- */
 
+// set the task 'tsk' as the writer owning the reader-writer lock 'rwl'
+// the lock is linked to the list of reader-writer locks held by the task, so the priority inherited through it
+// is kept by the task until the lock is released
+void core_rwl_link( rwl_t *rwl, tsk_t *tsk );
+
+// remove the writer owning the reader-writer lock 'rwl' and update its priority
+void core_rwl_unlink( rwl_t *rwl );
+
+/* -------------------------------------------------------------------------- */
+
+// set the task 'tsk' as the server serving the client of the remote procedure call 'rpc'
+// the call is linked to the list of calls served by the task, so the priority lent by the client
+// is kept by the task until the reply
+void core_rpc_link( rpc_t *rpc, tsk_t *tsk );
+
+// remove the server serving the client of the remote procedure call 'rpc' and update its priority
+void core_rpc_unlink( rpc_t *rpc );
+
+/* -------------------------------------------------------------------------- */
+
+// link all pollers from the list 'list' of size 'count' to the polled objects
+// the current task becomes the owner of the pollers
+void core_pol_link( pol_t *list, unsigned count );
+
+// resume execution of the task that registered the poller 'pol' with event value equal to the index of the poller in the list
+// unlink all pollers owned by the task from the polled objects
+void core_pol_wakeup( pol_t *pol );
+
+// resume execution of all tasks polling the object 'obj'
+__STATIC_INLINE
+void core_pol_notify( obj_t *obj )
+{
+	while (obj->pol) core_pol_wakeup(obj->pol);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#if HW_TIMER_SIZE < OS_TIMER_SIZE
+
+// read the system timer counter changed by the system timer interrupt
+// always a fresh load from memory, so the lock-free read loops below cannot be folded by the compiler
+__STATIC_INLINE
+cnt_t core_sys_cnt( void )
+{
+	return *(volatile cnt_t *)&System.cnt;
+}
+
+#endif
+
 // return current system time in tick-less mode
 #if HW_TIMER_SIZE < OS_TIMER_SIZE // because of CSMCC
 cnt_t port_sys_time( void );
 #endif
 
-// return current system time
+// return current system time; lock-free, the counter is read again if it was changed during reading
 __STATIC_INLINE
 cnt_t core_sys_time( void )
 {
 #if HW_TIMER_SIZE == 0
-	return System.cnt;
+	cnt_t cnt;
+	do cnt = core_sys_cnt(); while (cnt != core_sys_cnt());
+	return cnt;
 #else
 	return port_sys_time();
 #endif
 }
 
+// convert number of system ticks to microseconds (modulo 2^32)
+__STATIC_INLINE
+uint32_t core_tck_usec( cnt_t tck )
+{
+#if (OS_FREQUENCY) % 1000000 == 0
+	return (uint32_t)(tck / ((OS_FREQUENCY)/1000000));
+#elif 1000000 % (OS_FREQUENCY) == 0
+	return (uint32_t)tck * (1000000/(OS_FREQUENCY));
+#else
+	return (uint32_t)((uint64_t)tck * 1000000 / (OS_FREQUENCY));
+#endif
+}
+
+// convert number of microseconds to system ticks, rounding up
+__STATIC_INLINE
+cnt_t core_usec_tck( uint32_t usec )
+{
+#if (OS_FREQUENCY) % 1000000 == 0
+	return (cnt_t)usec * ((OS_FREQUENCY)/1000000);
+#elif 1000000 % (OS_FREQUENCY) == 0
+	return (cnt_t)(usec / (1000000/(OS_FREQUENCY)) + (usec % (1000000/(OS_FREQUENCY)) != 0));
+#else
+	return (cnt_t)(((uint64_t)usec * (OS_FREQUENCY) + 999999) / 1000000);
+#endif
+}
+
+// return current high resolution system time in microseconds (modulo 2^32); lock-free
+// tick mode: the tick counter and the time elapsed since the tick are read again if a tick interrupt came in between
+// tick-less mode: the hardware counter is the system time, so there is nothing finer to add to it
+__STATIC_INLINE
+uint32_t core_sys_hrtime( void )
+{
+#if HW_TIMER_SIZE == 0
+	cnt_t    cnt;
+	uint32_t usc;
+
+	do
+	{
+		cnt = core_sys_cnt();
+		usc = port_sys_usec();
+	}
+	while (cnt != core_sys_cnt());
+
+	return core_tck_usec(cnt) + usc;
+#else
+	return core_tck_usec(core_sys_time());
+#endif
+}
+
 // internal handler of system timer
 #if HW_TIMER_SIZE == 0
 void core_sys_tick( void );
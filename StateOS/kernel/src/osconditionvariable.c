@@ -30,6 +30,7 @@
  ******************************************************************************/
 
 #include "inc/osconditionvariable.h"
+#include "inc/ostask.h"
 #include "inc/oscriticalsection.h"
 #include "osalloc.h"
 
@@ -114,6 +115,25 @@ void cnd_destroy( cnd_t *cnd )
 	sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_cnd_relock( mtx_t *mtx, unsigned event )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned lock_event;
+
+	System.cur->mtx.tree = 0;
+
+	if (System.cur->tmp.cnd.mtx == 0 && mtx->owner == System.cur) // the mutex has been passed by cnd_give
+		return event;
+
+	lock_event = mtx_wait(mtx);
+	if (lock_event != E_SUCCESS)
+		return lock_event;
+
+	return event;
+}
+
 /* -------------------------------------------------------------------------- */
 unsigned cnd_waitFor( cnd_t *cnd, mtx_t *mtx, cnt_t delay )
 /* -------------------------------------------------------------------------- */
@@ -132,10 +152,9 @@ unsigned cnd_waitFor( cnd_t *cnd, mtx_t *mtx, cnt_t delay )
 		event = mtx_give(mtx);
 		if (event == E_SUCCESS)
 		{
+			System.cur->tmp.cnd.mtx = mtx;
 			wait_event = core_tsk_waitFor(&cnd->obj.queue, delay);
-			event = mtx_wait(mtx);
-			if (event == E_SUCCESS)
-				event = wait_event;
+			event = priv_cnd_relock(mtx, wait_event);
 		}
 	}
 	sys_unlock();
@@ -161,10 +180,9 @@ unsigned cnd_waitUntil( cnd_t *cnd, mtx_t *mtx, cnt_t time )
 		event = mtx_give(mtx);
 		if (event == E_SUCCESS)
 		{
+			System.cur->tmp.cnd.mtx = mtx;
 			wait_event = core_tsk_waitUntil(&cnd->obj.queue, time);
-			event = mtx_wait(mtx);
-			if (event == E_SUCCESS)
-				event = wait_event;
+			event = priv_cnd_relock(mtx, wait_event);
 		}
 	}
 	sys_unlock();
@@ -172,6 +190,53 @@ unsigned cnd_waitUntil( cnd_t *cnd, mtx_t *mtx, cnt_t time )
 	return event;
 }
 
+/* -------------------------------------------------------------------------- */
+static
+tsk_t *priv_cnd_wakeup( cnd_t *cnd )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *tsk = cnd->obj.queue;
+	mtx_t *mtx;
+	unsigned event = E_SUCCESS;
+
+	if (tsk)
+	{
+		mtx = tsk->tmp.cnd.mtx;
+
+		if (mtx->owner == 0 && ((mtx->mode & mtxPrioProtect) == 0 || mtx->prio >= tsk->prio))
+		{
+			// pass the free mutex directly to the task
+			tsk->tmp.cnd.mtx = 0;
+			core_mtx_link(mtx, tsk);
+
+			if ((mtx->mode & mtxInconsistent))
+			{
+				mtx->mode &= ~mtxInconsistent;
+				event = OWNERDEAD;
+			}
+
+			core_tsk_wakeup(tsk, event);
+		}
+		else
+		if (mtx->owner != 0 && mtx->owner != tsk)
+		{
+			// move the task to the mutex queue; it will be resumed by the mutex owner
+			// the task has consumed the signal, so it no longer waits with the timeout of the condition variable
+			tsk->tmp.cnd.mtx = 0;
+			tsk->mtx.tree = mtx;
+			tsk->delay = INFINITE;
+			core_tmr_remove((tmr_t *)tsk);
+			core_tsk_transfer(tsk, &mtx->obj.queue);
+		}
+		else
+		{
+			core_tsk_wakeup(tsk, event);
+		}
+	}
+
+	return tsk;
+}
+
 /* -------------------------------------------------------------------------- */
 void cnd_give( cnd_t *cnd, bool all )
 /* -------------------------------------------------------------------------- */
@@ -181,7 +246,10 @@ void cnd_give( cnd_t *cnd, bool all )
 
 	sys_lock();
 	{
-		while (core_one_wakeup(cnd->obj.queue, E_SUCCESS) && all);
+		if (port_isr_context())
+			while (core_one_wakeup(cnd->obj.queue, E_SUCCESS) && all);
+		else
+			while (priv_cnd_wakeup(cnd) && all);
 	}
 	sys_unlock();
 }
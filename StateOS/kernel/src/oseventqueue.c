@@ -96,6 +96,7 @@ void priv_evq_reset( evq_t *evq, unsigned event )
 	evq->tail  = 0;
 
 	core_all_wakeup(evq->obj.queue, event);
+	core_pol_notify(&evq->obj);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -187,6 +188,7 @@ void priv_evq_putUpdate( evq_t *evq, const unsigned data )
 	priv_evq_put(evq, data);
 	tsk = core_one_wakeup(evq->obj.queue, E_SUCCESS);
 	if (tsk) priv_evq_get(evq, tsk->tmp.evq.data.in);
+	else     core_pol_notify(&evq->obj);
 }
 
 /* -------------------------------------------------------------------------- */
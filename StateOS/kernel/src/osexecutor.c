@@ -0,0 +1,247 @@
+/******************************************************************************
+
+    @file    StateOS: osexecutor.c
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include "inc/osexecutor.h"
+#include "inc/ostask.h"
+#include "inc/oscriticalsection.h"
+#include "osalloc.h"
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_exe_done( exe_t *exe )
+/* -------------------------------------------------------------------------- */
+{
+	if (--exe->pend == 0)
+		core_all_wakeup(exe->obj.queue, E_SUCCESS);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_exe_worker( void )
+/* -------------------------------------------------------------------------- */
+{
+	exe_t *exe = System.cur->tmp.exe.exe;
+	exj_t  job;
+
+	for (;;)
+	{
+		box_wait(&exe->box, &job);
+
+		if (job.fun == 0)
+			tsk_stop();
+
+		job.fun(job.arg);
+
+		if (job.done)
+			sem_give(job.done);
+
+		sys_lock();
+		{
+			priv_exe_done(exe);
+		}
+		sys_unlock();
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+exe_t *exe_create( unsigned count, unsigned prio, unsigned limit )
+/* -------------------------------------------------------------------------- */
+{
+	exe_t  * exe;
+	unsigned bufsize;
+	unsigned i;
+
+	assert_tsk_context();
+	assert(count);
+	assert(limit);
+
+	sys_lock();
+	{
+		bufsize = limit * sizeof(exj_t);
+		exe = sys_alloc(sizeof(exe_t) + count * sizeof(tsk_t *) + bufsize);
+		core_obj_init(&exe->obj);
+		exe->obj.res = exe;
+		exe->wrk   = (tsk_t **)(exe + 1);
+		exe->count = count;
+		box_init(&exe->box, sizeof(exj_t), exe->wrk + count, bufsize);
+
+		for (i = 0; i < count; i++)
+		{
+			exe->wrk[i] = wrk_create(prio, priv_exe_worker, OS_STACK_SIZE);
+			exe->wrk[i]->tmp.exe.exe = exe; // workers cannot start before sys_unlock
+		}
+	}
+	sys_unlock();
+
+	return exe;
+}
+
+/* -------------------------------------------------------------------------- */
+void exe_destroy( exe_t *exe )
+/* -------------------------------------------------------------------------- */
+{
+	exj_t    job = { 0, 0, 0 };
+	unsigned i;
+
+	assert_tsk_context();
+	assert(exe);
+	assert(exe->obj.res!=RELEASED);
+
+	exe_wait(exe);
+
+	for (i = 0; i < exe->count; i++)
+		box_send(&exe->box, &job); // stop request for each worker
+	for (i = 0; i < exe->count; i++)
+		tsk_join(exe->wrk[i]);
+
+	sys_lock();
+	{
+		core_all_wakeup(exe->obj.queue, E_DELETED);
+		core_res_free(&exe->obj.res);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned exe_give( exe_t *exe, cbk_t *fun, void *arg, sem_t *done )
+/* -------------------------------------------------------------------------- */
+{
+	exj_t    job = { fun, arg, done };
+	unsigned event;
+
+	assert(exe);
+	assert(exe->obj.res!=RELEASED);
+	assert(fun);
+
+	sys_lock();
+	{
+		event = box_give(&exe->box, &job);
+
+		if (event == E_SUCCESS)
+			exe->pend++;
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned exe_sendFor( exe_t *exe, cbk_t *fun, void *arg, sem_t *done, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	exj_t    job = { fun, arg, done };
+	unsigned event;
+
+	assert_tsk_context();
+	assert(exe);
+	assert(exe->obj.res!=RELEASED);
+	assert(fun);
+
+	sys_lock();
+	{
+		exe->pend++;
+		event = box_sendFor(&exe->box, &job, delay);
+
+		if (event != E_SUCCESS)
+			priv_exe_done(exe);
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned exe_sendUntil( exe_t *exe, cbk_t *fun, void *arg, sem_t *done, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	exj_t    job = { fun, arg, done };
+	unsigned event;
+
+	assert_tsk_context();
+	assert(exe);
+	assert(exe->obj.res!=RELEASED);
+	assert(fun);
+
+	sys_lock();
+	{
+		exe->pend++;
+		event = box_sendUntil(&exe->box, &job, time);
+
+		if (event != E_SUCCESS)
+			priv_exe_done(exe);
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned exe_waitFor( exe_t *exe, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event = E_SUCCESS;
+
+	assert_tsk_context();
+	assert(exe);
+	assert(exe->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		if (exe->pend)
+			event = core_tsk_waitFor(&exe->obj.queue, delay);
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned exe_waitUntil( exe_t *exe, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event = E_SUCCESS;
+
+	assert_tsk_context();
+	assert(exe);
+	assert(exe->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		if (exe->pend)
+			event = core_tsk_waitUntil(&exe->obj.queue, time);
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
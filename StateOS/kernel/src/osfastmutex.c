@@ -141,11 +141,11 @@ unsigned mut_take( mut_t *mut )
 	assert(mut);
 	assert(mut->obj.res!=RELEASED);
 
-	sys_lock();
+	core_ctx_lock();
 	{
 		event = priv_mut_take(mut);
 	}
-	sys_unlock();
+	core_ctx_unlock();
 
 	return event;
 }
@@ -160,14 +160,23 @@ unsigned mut_waitFor( mut_t *mut, cnt_t delay )
 	assert(mut);
 	assert(mut->obj.res!=RELEASED);
 
-	sys_lock();
+	core_ctx_lock();
 	{
 		event = priv_mut_take(mut);
+	}
+	core_ctx_unlock();
 
-		if (event == E_TIMEOUT)
-			event = core_tsk_waitFor(&mut->obj.queue, delay);
+	if (event == E_TIMEOUT)
+	{
+		sys_lock();
+		{
+			event = priv_mut_take(mut);
+
+			if (event == E_TIMEOUT)
+				event = core_tsk_waitFor(&mut->obj.queue, delay);
+		}
+		sys_unlock();
 	}
-	sys_unlock();
 
 	return event;
 }
@@ -182,14 +191,23 @@ unsigned mut_waitUntil( mut_t *mut, cnt_t time )
 	assert(mut);
 	assert(mut->obj.res!=RELEASED);
 
-	sys_lock();
+	core_ctx_lock();
 	{
 		event = priv_mut_take(mut);
+	}
+	core_ctx_unlock();
 
-		if (event == E_TIMEOUT)
-			event = core_tsk_waitUntil(&mut->obj.queue, time);
+	if (event == E_TIMEOUT)
+	{
+		sys_lock();
+		{
+			event = priv_mut_take(mut);
+
+			if (event == E_TIMEOUT)
+				event = core_tsk_waitUntil(&mut->obj.queue, time);
+		}
+		sys_unlock();
 	}
-	sys_unlock();
 
 	return event;
 }
@@ -208,6 +226,23 @@ unsigned priv_mut_give( mut_t *mut )
 	return E_FAILURE;
 }
 
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_mut_release( mut_t *mut )
+/* -------------------------------------------------------------------------- */
+{
+	if (mut->owner == System.cur)
+	{
+		if (mut->obj.queue)
+			return E_TIMEOUT;
+
+		mut->owner = 0;
+		return E_SUCCESS;
+	}
+
+	return E_FAILURE;
+}
+
 /* -------------------------------------------------------------------------- */
 unsigned mut_give( mut_t *mut )
 /* -------------------------------------------------------------------------- */
@@ -218,11 +253,20 @@ unsigned mut_give( mut_t *mut )
 	assert(mut);
 	assert(mut->obj.res!=RELEASED);
 
-	sys_lock();
+	core_ctx_lock();
 	{
-		event = priv_mut_give(mut);
+		event = priv_mut_release(mut);
+	}
+	core_ctx_unlock();
+
+	if (event == E_TIMEOUT)
+	{
+		sys_lock();
+		{
+			event = priv_mut_give(mut);
+		}
+		sys_unlock();
 	}
-	sys_unlock();
 
 	return event;
 }
@@ -31,6 +31,7 @@
 
 #include "inc/osflag.h"
 #include "inc/ostask.h"
+#include "inc/ospoll.h"
 #include "inc/oscriticalsection.h"
 #include "osalloc.h"
 
@@ -86,6 +87,7 @@ void priv_flg_reset( flg_t *flg, unsigned event )
 	flg->flags = 0;
 
 	core_all_wakeup(flg->obj.queue, event);
+	core_pol_notify(&flg->obj);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -226,6 +228,7 @@ unsigned flg_give( flg_t *flg, unsigned flags )
 {
 	obj_t *obj;
 	tsk_t *tsk;
+	pol_t *pol;
 
 	assert(flg);
 	assert(flg->obj.res!=RELEASED);
@@ -252,6 +255,18 @@ unsigned flg_give( flg_t *flg, unsigned flags )
 			obj = &tsk->hdr.obj;
 		}
 
+		pol = flg->obj.pol;
+		while (pol)
+		{
+			if (flg->flags & pol->flags)
+			{
+				core_pol_wakeup(pol);
+				pol = flg->obj.pol;
+				continue;
+			}
+			pol = pol->next;
+		}
+
 		flags = flg->flags;
 	}
 	sys_unlock();
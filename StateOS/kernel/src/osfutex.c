@@ -0,0 +1,122 @@
+/******************************************************************************
+
+    @file    StateOS: osfutex.c
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include "inc/osfutex.h"
+#include "inc/ostask.h"
+#include "inc/oscriticalsection.h"
+
+/* -------------------------------------------------------------------------- */
+
+static tsk_t *FUT[OS_FUTEX_QUEUES]; // futex hash table of wait queues
+
+/* -------------------------------------------------------------------------- */
+static
+tsk_t **priv_fut_queue( volatile unsigned *addr )
+/* -------------------------------------------------------------------------- */
+{
+	return &FUT[((uintptr_t)addr / sizeof(unsigned)) % (OS_FUTEX_QUEUES)];
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned fut_waitFor( volatile unsigned *addr, unsigned value, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event = E_FAILURE;
+
+	assert_tsk_context();
+	assert(addr);
+
+	sys_lock();
+	{
+		if (*addr == value)
+		{
+			System.cur->tmp.fut.addr = addr;
+			event = core_tsk_waitFor(priv_fut_queue(addr), delay);
+		}
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned fut_waitUntil( volatile unsigned *addr, unsigned value, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event = E_FAILURE;
+
+	assert_tsk_context();
+	assert(addr);
+
+	sys_lock();
+	{
+		if (*addr == value)
+		{
+			System.cur->tmp.fut.addr = addr;
+			event = core_tsk_waitUntil(priv_fut_queue(addr), time);
+		}
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned fut_wake( volatile unsigned *addr, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t ** que;
+	tsk_t  * tsk;
+	unsigned cnt = 0;
+
+	assert(addr);
+
+	sys_lock();
+	{
+		que = priv_fut_queue(addr);
+		while (cnt < count && (tsk = *que) != 0)
+		{
+			if (tsk->tmp.fut.addr == addr)
+			{
+				core_tsk_wakeup(tsk, E_SUCCESS);
+				cnt++;
+				continue;
+			}
+			que = &tsk->hdr.obj.queue;
+		}
+	}
+	sys_unlock();
+
+	return cnt;
+}
+
+/* -------------------------------------------------------------------------- */
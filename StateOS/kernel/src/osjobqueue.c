@@ -36,17 +36,17 @@
 
 /* -------------------------------------------------------------------------- */
 static
-void priv_job_init( job_t *job, fun_t **data, unsigned bufsize )
+void priv_job_init( job_t *job, jbe_t *data, unsigned bufsize )
 /* -------------------------------------------------------------------------- */
 {
 	core_obj_init(&job->obj);
 
-	job->limit = bufsize / sizeof(fun_t *);
+	job->limit = bufsize / sizeof(jbe_t);
 	job->data  = data;
 }
 
 /* -------------------------------------------------------------------------- */
-void job_init( job_t *job, fun_t **data, unsigned bufsize )
+void job_init( job_t *job, jbe_t *data, unsigned bufsize )
 /* -------------------------------------------------------------------------- */
 {
 	assert_tsk_context();
@@ -76,7 +76,7 @@ job_t *job_create( unsigned limit )
 
 	sys_lock();
 	{
-		bufsize = limit * sizeof(fun_t *);
+		bufsize = limit * sizeof(jbe_t);
 		tmp = sys_alloc(sizeof(struct job_T) + bufsize);
 		priv_job_init(job = &tmp->job, tmp->buf, bufsize);
 		job->obj.res = job;
@@ -131,29 +131,42 @@ void job_destroy( job_t *job )
 
 /* -------------------------------------------------------------------------- */
 static
-void priv_job_get( job_t *job, fun_t **fun )
+void priv_job_get( job_t *job, jbe_t *ent )
 /* -------------------------------------------------------------------------- */
 {
 	unsigned i = job->head;
 
-	*fun = job->data[i++];
+	*ent = job->data[i++];
 	job->head = (i < job->limit) ? i : 0;
 	job->count--;
 }
 
 /* -------------------------------------------------------------------------- */
 static
-void priv_job_put( job_t *job, fun_t *fun )
+void priv_job_put( job_t *job, const jbe_t *ent )
 /* -------------------------------------------------------------------------- */
 {
 	unsigned i = job->tail;
 
-	job->data[i++] = fun;
+	job->data[i++] = *ent;
 
 	job->tail = (i < job->limit) ? i : 0;
 	job->count++;
 }
 
+/* -------------------------------------------------------------------------- */
+static
+void priv_job_putFirst( job_t *job, const jbe_t *ent )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned i = (job->head > 0) ? job->head : job->limit;
+
+	job->data[--i] = *ent;
+
+	job->head = i;
+	job->count++;
+}
+
 /* -------------------------------------------------------------------------- */
 static
 void priv_job_skip( job_t *job )
@@ -166,24 +179,36 @@ void priv_job_skip( job_t *job )
 
 /* -------------------------------------------------------------------------- */
 static
-void priv_job_getUpdate( job_t *job, fun_t **fun )
+void priv_job_getUpdate( job_t *job, jbe_t *ent )
 /* -------------------------------------------------------------------------- */
 {
 	tsk_t *tsk;
 
-	priv_job_get(job, fun);
+	priv_job_get(job, ent);
 	tsk = core_one_wakeup(job->obj.queue, E_SUCCESS);
 	if (tsk) priv_job_put(job, tsk->tmp.job.data.out);
 }
 
 /* -------------------------------------------------------------------------- */
 static
-void priv_job_putUpdate( job_t *job, fun_t *fun )
+void priv_job_putUpdate( job_t *job, const jbe_t *ent )
 /* -------------------------------------------------------------------------- */
 {
 	tsk_t *tsk;
 
-	priv_job_put(job, fun);
+	priv_job_put(job, ent);
+	tsk = core_one_wakeup(job->obj.queue, E_SUCCESS);
+	if (tsk) priv_job_get(job, tsk->tmp.job.data.in);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_job_putFirstUpdate( job_t *job, const jbe_t *ent )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *tsk;
+
+	priv_job_putFirst(job, ent);
 	tsk = core_one_wakeup(job->obj.queue, E_SUCCESS);
 	if (tsk) priv_job_get(job, tsk->tmp.job.data.in);
 }
@@ -205,23 +230,34 @@ void priv_job_skipUpdate( job_t *job )
 
 /* -------------------------------------------------------------------------- */
 static
-unsigned priv_job_take( job_t *job, fun_t **fun )
+unsigned priv_job_take( job_t *job, jbe_t *ent )
 /* -------------------------------------------------------------------------- */
 {
 	if (job->count > 0)
 	{
-		priv_job_getUpdate(job, fun);
+		priv_job_getUpdate(job, ent);
 		return E_SUCCESS;
 	}
 
 	return E_TIMEOUT;
 }
 
+/* -------------------------------------------------------------------------- */
+static
+void priv_job_exec( jbe_t *ent )
+/* -------------------------------------------------------------------------- */
+{
+	if (ent->fun)
+		ent->fun(ent->data.arg);
+	else
+		ent->data.job();
+}
+
 /* -------------------------------------------------------------------------- */
 unsigned job_take( job_t *job )
 /* -------------------------------------------------------------------------- */
 {
-	fun_t  * fun;
+	jbe_t    ent;
 	unsigned event;
 
 	assert(job);
@@ -231,12 +267,12 @@ unsigned job_take( job_t *job )
 
 	sys_lock();
 	{
-		event = priv_job_take(job, &fun);
+		event = priv_job_take(job, &ent);
 	}
 	sys_unlock();
 
 	if (event == E_SUCCESS)
-		fun();
+		priv_job_exec(&ent);
 
 	return event;
 }
@@ -245,7 +281,7 @@ unsigned job_take( job_t *job )
 unsigned job_waitFor( job_t *job, cnt_t delay )
 /* -------------------------------------------------------------------------- */
 {
-	fun_t  * fun;
+	jbe_t    ent;
 	unsigned event;
 
 	assert_tsk_context();
@@ -256,18 +292,18 @@ unsigned job_waitFor( job_t *job, cnt_t delay )
 
 	sys_lock();
 	{
-		event = priv_job_take(job, &fun);
+		event = priv_job_take(job, &ent);
 
 		if (event == E_TIMEOUT)
 		{
-			System.cur->tmp.job.data.in = &fun;
+			System.cur->tmp.job.data.in = &ent;
 			event = core_tsk_waitFor(&job->obj.queue, delay);
 		}
 	}
 	sys_unlock();
 
 	if (event == E_SUCCESS)
-		fun();
+		priv_job_exec(&ent);
 
 	return event;
 }
@@ -276,7 +312,7 @@ unsigned job_waitFor( job_t *job, cnt_t delay )
 unsigned job_waitUntil( job_t *job, cnt_t time )
 /* -------------------------------------------------------------------------- */
 {
-	fun_t  * fun;
+	jbe_t    ent;
 	unsigned event;
 
 	assert_tsk_context();
@@ -287,30 +323,30 @@ unsigned job_waitUntil( job_t *job, cnt_t time )
 
 	sys_lock();
 	{
-		event = priv_job_take(job, &fun);
+		event = priv_job_take(job, &ent);
 
 		if (event == E_TIMEOUT)
 		{
-			System.cur->tmp.job.data.in = &fun;
+			System.cur->tmp.job.data.in = &ent;
 			event = core_tsk_waitUntil(&job->obj.queue, time);
 		}
 	}
 	sys_unlock();
 
 	if (event == E_SUCCESS)
-		fun();
+		priv_job_exec(&ent);
 
 	return event;
 }
 
 /* -------------------------------------------------------------------------- */
 static
-unsigned priv_job_give( job_t *job, fun_t *fun )
+unsigned priv_job_give( job_t *job, const jbe_t *ent )
 /* -------------------------------------------------------------------------- */
 {
 	if (job->count < job->limit)
 	{
-		priv_job_putUpdate(job, fun);
+		priv_job_putUpdate(job, ent);
 		return E_SUCCESS;
 	}
 
@@ -318,7 +354,8 @@ unsigned priv_job_give( job_t *job, fun_t *fun )
 }
 
 /* -------------------------------------------------------------------------- */
-unsigned job_give( job_t *job, fun_t *fun )
+static
+unsigned priv_job_giveEntry( job_t *job, const jbe_t *ent )
 /* -------------------------------------------------------------------------- */
 {
 	unsigned event;
@@ -327,11 +364,67 @@ unsigned job_give( job_t *job, fun_t *fun )
 	assert(job->obj.res!=RELEASED);
 	assert(job->data);
 	assert(job->limit);
+
+	sys_lock();
+	{
+		event = priv_job_give(job, ent);
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned job_give( job_t *job, fun_t *fun )
+/* -------------------------------------------------------------------------- */
+{
+	jbe_t ent;
+
+	assert(fun);
+
+	ent.fun = 0;
+	ent.data.job = fun;
+
+	return priv_job_giveEntry(job, &ent);
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned job_giveArg( job_t *job, cbk_t *fun, void *arg )
+/* -------------------------------------------------------------------------- */
+{
+	jbe_t ent;
+
 	assert(fun);
 
+	ent.fun = fun;
+	ent.data.arg = arg;
+
+	return priv_job_giveEntry(job, &ent);
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned job_giveBatch( job_t *job, const jbe_t *ent, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event = E_TIMEOUT;
+
+	assert(job);
+	assert(job->obj.res!=RELEASED);
+	assert(job->data);
+	assert(job->limit);
+	assert(ent || !count);
+
 	sys_lock();
 	{
-		event = priv_job_give(job, fun);
+		if (count <= job->limit - job->count)
+		{
+			while (count--)
+			{
+				assert(ent->fun || ent->data.job);
+				priv_job_putUpdate(job, ent++);
+			}
+			event = E_SUCCESS;
+		}
 	}
 	sys_unlock();
 
@@ -339,7 +432,61 @@ unsigned job_give( job_t *job, fun_t *fun )
 }
 
 /* -------------------------------------------------------------------------- */
-unsigned job_sendFor( job_t *job, fun_t *fun, cnt_t delay )
+static
+unsigned priv_job_giveFirst( job_t *job, const jbe_t *ent )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event = E_TIMEOUT;
+
+	assert(job);
+	assert(job->obj.res!=RELEASED);
+	assert(job->data);
+	assert(job->limit);
+
+	sys_lock();
+	{
+		if (job->count < job->limit)
+		{
+			priv_job_putFirstUpdate(job, ent);
+			event = E_SUCCESS;
+		}
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned job_giveUrgent( job_t *job, fun_t *fun )
+/* -------------------------------------------------------------------------- */
+{
+	jbe_t ent;
+
+	assert(fun);
+
+	ent.fun = 0;
+	ent.data.job = fun;
+
+	return priv_job_giveFirst(job, &ent);
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned job_giveUrgentArg( job_t *job, cbk_t *fun, void *arg )
+/* -------------------------------------------------------------------------- */
+{
+	jbe_t ent;
+
+	assert(fun);
+
+	ent.fun = fun;
+	ent.data.arg = arg;
+
+	return priv_job_giveFirst(job, &ent);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_job_sendFor( job_t *job, const jbe_t *ent, cnt_t delay )
 /* -------------------------------------------------------------------------- */
 {
 	unsigned event;
@@ -349,15 +496,14 @@ unsigned job_sendFor( job_t *job, fun_t *fun, cnt_t delay )
 	assert(job->obj.res!=RELEASED);
 	assert(job->data);
 	assert(job->limit);
-	assert(fun);
 
 	sys_lock();
 	{
-		event = priv_job_give(job, fun);
+		event = priv_job_give(job, ent);
 
 		if (event == E_TIMEOUT)
 		{
-			System.cur->tmp.job.data.out = fun;
+			System.cur->tmp.job.data.out = ent;
 			event = core_tsk_waitFor(&job->obj.queue, delay);
 		}
 	}
@@ -367,7 +513,36 @@ unsigned job_sendFor( job_t *job, fun_t *fun, cnt_t delay )
 }
 
 /* -------------------------------------------------------------------------- */
-unsigned job_sendUntil( job_t *job, fun_t *fun, cnt_t time )
+unsigned job_sendFor( job_t *job, fun_t *fun, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	jbe_t ent;
+
+	assert(fun);
+
+	ent.fun = 0;
+	ent.data.job = fun;
+
+	return priv_job_sendFor(job, &ent, delay);
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned job_sendForArg( job_t *job, cbk_t *fun, void *arg, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	jbe_t ent;
+
+	assert(fun);
+
+	ent.fun = fun;
+	ent.data.arg = arg;
+
+	return priv_job_sendFor(job, &ent, delay);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_job_sendUntil( job_t *job, const jbe_t *ent, cnt_t time )
 /* -------------------------------------------------------------------------- */
 {
 	unsigned event;
@@ -377,15 +552,14 @@ unsigned job_sendUntil( job_t *job, fun_t *fun, cnt_t time )
 	assert(job->obj.res!=RELEASED);
 	assert(job->data);
 	assert(job->limit);
-	assert(fun);
 
 	sys_lock();
 	{
-		event = priv_job_give(job, fun);
+		event = priv_job_give(job, ent);
 
 		if (event == E_TIMEOUT)
 		{
-			System.cur->tmp.job.data.out = fun;
+			System.cur->tmp.job.data.out = ent;
 			event = core_tsk_waitUntil(&job->obj.queue, time);
 		}
 	}
@@ -395,23 +569,79 @@ unsigned job_sendUntil( job_t *job, fun_t *fun, cnt_t time )
 }
 
 /* -------------------------------------------------------------------------- */
-void job_push( job_t *job, fun_t *fun )
+unsigned job_sendUntil( job_t *job, fun_t *fun, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	jbe_t ent;
+
+	assert(fun);
+
+	ent.fun = 0;
+	ent.data.job = fun;
+
+	return priv_job_sendUntil(job, &ent, time);
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned job_sendUntilArg( job_t *job, cbk_t *fun, void *arg, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	jbe_t ent;
+
+	assert(fun);
+
+	ent.fun = fun;
+	ent.data.arg = arg;
+
+	return priv_job_sendUntil(job, &ent, time);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_job_push( job_t *job, const jbe_t *ent )
 /* -------------------------------------------------------------------------- */
 {
 	assert(job);
 	assert(job->obj.res!=RELEASED);
 	assert(job->data);
 	assert(job->limit);
-	assert(fun);
 
 	sys_lock();
 	{
 		priv_job_skipUpdate(job);
-		priv_job_putUpdate(job, fun);
+		priv_job_putUpdate(job, ent);
 	}
 	sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+void job_push( job_t *job, fun_t *fun )
+/* -------------------------------------------------------------------------- */
+{
+	jbe_t ent;
+
+	assert(fun);
+
+	ent.fun = 0;
+	ent.data.job = fun;
+
+	priv_job_push(job, &ent);
+}
+
+/* -------------------------------------------------------------------------- */
+void job_pushArg( job_t *job, cbk_t *fun, void *arg )
+/* -------------------------------------------------------------------------- */
+{
+	jbe_t ent;
+
+	assert(fun);
+
+	ent.fun = fun;
+	ent.data.arg = arg;
+
+	priv_job_push(job, &ent);
+}
+
 /* -------------------------------------------------------------------------- */
 unsigned job_count( job_t *job )
 /* -------------------------------------------------------------------------- */
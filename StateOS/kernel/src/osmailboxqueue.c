@@ -99,6 +99,7 @@ void priv_box_reset( box_t *box, unsigned event )
 	box->tail  = 0;
 
 	core_all_wakeup(box->obj.queue, event);
+	core_pol_notify(&box->obj);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -192,6 +193,7 @@ void priv_box_putUpdate( box_t *box, const char *data )
 	priv_box_put(box, data);
 	tsk = core_one_wakeup(box->obj.queue, E_SUCCESS);
 	if (tsk) priv_box_get(box, tsk->tmp.box.data.in);
+	else     core_pol_notify(&box->obj);
 }
 
 /* -------------------------------------------------------------------------- */
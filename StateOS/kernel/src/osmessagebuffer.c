@@ -95,6 +95,7 @@ void priv_msg_reset( msg_t *msg, unsigned event )
 	msg->tail  = 0;
 
 	core_all_wakeup(msg->obj.queue, event);
+	core_pol_notify(&msg->obj);
 }
 
 
@@ -260,6 +261,9 @@ void priv_msg_putUpdate( msg_t *msg, const char *data, unsigned size )
 			core_one_wakeup(msg->obj.queue, E_FAILURE);
 		}
 	}
+
+	if (msg->count > 0)
+		core_pol_notify(&msg->obj);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -53,7 +53,6 @@ void mtx_init( mtx_t *mtx, unsigned mode, unsigned prio )
 	assert(mtx);
 	assert((mtx->mode & ~mtxMASK) == 0);
 	assert((mtx->mode &  mtxTypeMASK) != mtxTypeMASK);
-	assert((mtx->mode &  mtxPrioMASK) != mtxPrioMASK);
 
 	sys_lock();
 	{
@@ -123,9 +122,9 @@ void mtx_setPrio( mtx_t *mtx, unsigned prio )
 
 	sys_lock();
 	{
-		mtx->prio = prio;
+		core_mtx_prio(mtx, prio);
 
-		if ((mtx->mode & mtxPrioMASK) == mtxPrioProtect)
+		if ((mtx->mode & mtxPrioProtect))
 			while (mtx->obj.queue && mtx->obj.queue->prio > prio)
 				core_one_wakeup(mtx->obj.queue, E_FAILURE);
 	}
@@ -156,7 +155,7 @@ static
 unsigned priv_mtx_take( mtx_t *mtx )
 /* -------------------------------------------------------------------------- */
 {
-	if ((mtx->mode & mtxPrioMASK) == mtxPrioProtect && mtx->prio < System.cur->prio)
+	if ((mtx->mode & mtxPrioProtect) && mtx->prio < System.cur->prio)
 		return E_FAILURE;
 
 	if (mtx->owner == 0)
@@ -186,6 +185,23 @@ unsigned priv_mtx_take( mtx_t *mtx )
 	return E_FAILURE;
 }
 
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_mtx_compete( mtx_t *mtx, unsigned event )
+/* -------------------------------------------------------------------------- */
+{
+	// barging mutex has been released and the task has been resumed to compete for it
+	while (event == E_SUCCESS && mtx->owner != System.cur)
+	{
+		event = priv_mtx_take(mtx);
+
+		if (event == E_TIMEOUT) // the mutex has been taken again; wait till the end of the original timeout
+			event = core_tsk_waitNext(&mtx->obj.queue, System.cur->delay);
+	}
+
+	return event;
+}
+
 /* -------------------------------------------------------------------------- */
 unsigned mtx_take( mtx_t *mtx )
 /* -------------------------------------------------------------------------- */
@@ -197,13 +213,12 @@ unsigned mtx_take( mtx_t *mtx )
 	assert(mtx->obj.res!=RELEASED);
 	assert((mtx->mode & ~mtxMASK) == 0);
 	assert((mtx->mode &  mtxTypeMASK) != mtxTypeMASK);
-	assert((mtx->mode &  mtxPrioMASK) != mtxPrioMASK);
 
-	sys_lock();
+	core_ctx_lock();
 	{
 		event = priv_mtx_take(mtx);
 	}
-	sys_unlock();
+	core_ctx_unlock();
 
 	return event;
 }
@@ -219,23 +234,29 @@ unsigned mtx_waitFor( mtx_t *mtx, cnt_t delay )
 	assert(mtx->obj.res!=RELEASED);
 	assert((mtx->mode & ~mtxMASK) == 0);
 	assert((mtx->mode &  mtxTypeMASK) != mtxTypeMASK);
-	assert((mtx->mode &  mtxPrioMASK) != mtxPrioMASK);
 
-	sys_lock();
+	core_ctx_lock();
 	{
 		event = priv_mtx_take(mtx);
+	}
+	core_ctx_unlock();
 
-		if (event == E_TIMEOUT)
+	if (event == E_TIMEOUT)
+	{
+		sys_lock();
 		{
-			if ((mtx->mode & mtxPrioMASK) != mtxPrioNone && mtx->owner->prio < System.cur->prio)
-				core_tsk_prio(mtx->owner, System.cur->prio);
-
-			System.cur->mtx.tree = mtx;
-			event = core_tsk_waitFor(&mtx->obj.queue, delay);
-			System.cur->mtx.tree = 0;
+			event = priv_mtx_take(mtx);
+
+			if (event == E_TIMEOUT)
+			{
+				System.cur->mtx.tree = mtx;
+				event = core_tsk_waitFor(&mtx->obj.queue, delay);
+				event = priv_mtx_compete(mtx, event);
+				System.cur->mtx.tree = 0;
+			}
 		}
+		sys_unlock();
 	}
-	sys_unlock();
 
 	return event;
 }
@@ -251,23 +272,29 @@ unsigned mtx_waitUntil( mtx_t *mtx, cnt_t time )
 	assert(mtx->obj.res!=RELEASED);
 	assert((mtx->mode & ~mtxMASK) == 0);
 	assert((mtx->mode &  mtxTypeMASK) != mtxTypeMASK);
-	assert((mtx->mode &  mtxPrioMASK) != mtxPrioMASK);
 
-	sys_lock();
+	core_ctx_lock();
 	{
 		event = priv_mtx_take(mtx);
+	}
+	core_ctx_unlock();
 
-		if (event == E_TIMEOUT)
+	if (event == E_TIMEOUT)
+	{
+		sys_lock();
 		{
-			if ((mtx->mode & mtxPrioMASK) != mtxPrioNone && mtx->owner->prio < System.cur->prio)
-				core_tsk_prio(mtx->owner, System.cur->prio);
-
-			System.cur->mtx.tree = mtx;
-			event = core_tsk_waitUntil(&mtx->obj.queue, time);
-			System.cur->mtx.tree = 0;
+			event = priv_mtx_take(mtx);
+
+			if (event == E_TIMEOUT)
+			{
+				System.cur->mtx.tree = mtx;
+				event = core_tsk_waitUntil(&mtx->obj.queue, time);
+				event = priv_mtx_compete(mtx, event);
+				System.cur->mtx.tree = 0;
+			}
 		}
+		sys_unlock();
 	}
-	sys_unlock();
 
 	return event;
 }
@@ -285,6 +312,13 @@ unsigned priv_mtx_give( mtx_t *mtx )
 			return E_SUCCESS;
 		}
 
+		if ((mtx->mode & mtxBarging))
+		{
+			core_mtx_unlink(mtx);
+			core_one_wakeup(mtx->obj.queue, E_SUCCESS);
+			return E_SUCCESS;
+		}
+
 		core_mtx_transferLock(mtx, E_SUCCESS);
 		return E_SUCCESS;
 	}
@@ -292,6 +326,29 @@ unsigned priv_mtx_give( mtx_t *mtx )
 	return E_FAILURE;
 }
 
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_mtx_release( mtx_t *mtx )
+/* -------------------------------------------------------------------------- */
+{
+	if (mtx->owner == System.cur)
+	{
+		if (mtx->count > 0)
+		{
+			mtx->count--;
+			return E_SUCCESS;
+		}
+
+		if (mtx->obj.queue == 0 && System.cur->prio == System.cur->basic)
+		{
+			core_mtx_unlink(mtx);
+			return E_SUCCESS;
+		}
+	}
+
+	return E_TIMEOUT;
+}
+
 /* -------------------------------------------------------------------------- */
 unsigned mtx_give( mtx_t *mtx )
 /* -------------------------------------------------------------------------- */
@@ -303,13 +360,21 @@ unsigned mtx_give( mtx_t *mtx )
 	assert(mtx->obj.res!=RELEASED);
 	assert((mtx->mode & ~mtxMASK) == 0);
 	assert((mtx->mode &  mtxTypeMASK) != mtxTypeMASK);
-	assert((mtx->mode &  mtxPrioMASK) != mtxPrioMASK);
 
-	sys_lock();
+	core_ctx_lock();
 	{
-		event = priv_mtx_give(mtx);
+		event = priv_mtx_release(mtx);
+	}
+	core_ctx_unlock();
+
+	if (event == E_TIMEOUT)
+	{
+		sys_lock();
+		{
+			event = priv_mtx_give(mtx);
+		}
+		sys_unlock();
 	}
-	sys_unlock();
 
 	return event;
 }
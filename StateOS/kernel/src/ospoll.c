@@ -0,0 +1,145 @@
+/******************************************************************************
+
+    @file    StateOS: ospoll.c
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include "inc/ospoll.h"
+#include "inc/ossemaphore.h"
+#include "inc/osflag.h"
+#include "inc/osstreambuffer.h"
+#include "inc/osmessagebuffer.h"
+#include "inc/osmailboxqueue.h"
+#include "inc/oseventqueue.h"
+#include "inc/ostask.h"
+#include "inc/oscriticalsection.h"
+
+/* -------------------------------------------------------------------------- */
+static
+bool priv_pol_ready( pol_t *pol )
+/* -------------------------------------------------------------------------- */
+{
+	switch (pol->type)
+	{
+	case polSemaphore:     return ((sem_t *)pol->obj)->count > 0;
+	case polFlag:          return (((flg_t *)pol->obj)->flags & pol->flags) != 0;
+	case polStreamBuffer:  return ((stm_t *)pol->obj)->count > 0;
+	case polMessageBuffer: return ((msg_t *)pol->obj)->count > 0;
+	case polMailBoxQueue:  return ((box_t *)pol->obj)->count > 0;
+	case polEventQueue:    return ((evq_t *)pol->obj)->count > 0;
+	case polTimer:         return ((tmr_t *)pol->obj)->hdr.next != 0 && ((tmr_t *)pol->obj)->hdr.id == ID_STOPPED;
+	}
+
+	assert(!"invalid type of polled object");
+	return false;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_pol_take( pol_t *list, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned i;
+
+	for (i = 0; i < count; i++)
+		if (priv_pol_ready(&list[i]))
+			return i;
+
+	return E_TIMEOUT;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned sys_takeAny( pol_t *list, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event;
+
+	assert(list);
+	assert(count);
+
+	sys_lock();
+	{
+		event = priv_pol_take(list, count);
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned sys_waitAny( pol_t *list, unsigned count, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event;
+
+	assert_tsk_context();
+	assert(list);
+	assert(count);
+
+	sys_lock();
+	{
+		event = priv_pol_take(list, count);
+
+		if (event == E_TIMEOUT && delay != IMMEDIATE)
+		{
+			core_pol_link(list, count);
+			event = core_tsk_waitFor(&System.cur->tmp.pol.queue, delay);
+		}
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned sys_waitAnyUntil( pol_t *list, unsigned count, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event;
+
+	assert_tsk_context();
+	assert(list);
+	assert(count);
+
+	sys_lock();
+	{
+		event = priv_pol_take(list, count);
+
+		if (event == E_TIMEOUT && (cnt_t)(time - core_sys_time() - 1) <= ((CNT_MAX)>>1)) // don't link pollers if the time point has already passed
+		{
+			core_pol_link(list, count);
+			event = core_tsk_waitUntil(&System.cur->tmp.pol.queue, time);
+		}
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,380 @@
+/******************************************************************************
+
+    @file    StateOS: osreaderwriterlock.c
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include "inc/osreaderwriterlock.h"
+#include "inc/ostask.h"
+#include "inc/oscriticalsection.h"
+#include "osalloc.h"
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_rwl_init( rwl_t *rwl, unsigned mode )
+/* -------------------------------------------------------------------------- */
+{
+	core_obj_init(&rwl->obj);
+
+	rwl->mode = mode;
+}
+
+/* -------------------------------------------------------------------------- */
+void rwl_init( rwl_t *rwl, unsigned mode )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(rwl);
+	assert((mode & ~rwlMASK) == 0);
+
+	sys_lock();
+	{
+		memset(rwl, 0, sizeof(rwl_t));
+		priv_rwl_init(rwl, mode);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+rwl_t *rwl_create( unsigned mode )
+/* -------------------------------------------------------------------------- */
+{
+	rwl_t *rwl;
+
+	assert_tsk_context();
+	assert((mode & ~rwlMASK) == 0);
+
+	sys_lock();
+	{
+		rwl = sys_alloc(sizeof(rwl_t));
+		priv_rwl_init(rwl, mode);
+		rwl->obj.res = rwl;
+	}
+	sys_unlock();
+
+	return rwl;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_rwl_reset( rwl_t *rwl, unsigned event )
+/* -------------------------------------------------------------------------- */
+{
+	core_rwl_unlink(rwl);
+
+	rwl->count = 0;
+
+	core_all_wakeup(rwl->obj.queue, event);
+	core_all_wakeup(rwl->queue, event);
+}
+
+/* -------------------------------------------------------------------------- */
+void rwl_reset( rwl_t *rwl )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(rwl);
+	assert(rwl->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_rwl_reset(rwl, E_STOPPED);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void rwl_destroy( rwl_t *rwl )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(rwl);
+	assert(rwl->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_rwl_reset(rwl, rwl->obj.res ? E_DELETED : E_STOPPED);
+		core_res_free(&rwl->obj.res);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_rwl_inherit( rwl_t *rwl )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *tsk = rwl->owner;
+
+	// the current task is going to wait for the lock
+	if (tsk && (rwl->mode & rwlPrioMASK) == rwlPrioInherit && tsk->prio < System.cur->prio)
+		core_tsk_prio(tsk, System.cur->prio);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_rwl_wakeup( rwl_t *rwl )
+/* -------------------------------------------------------------------------- */
+{
+	if (rwl->owner != 0)
+		return;
+
+	if (rwl->count == 0 && rwl->obj.queue && ((rwl->mode & rwlPrefMASK) == rwlWriterPref || rwl->queue == 0))
+	{
+		core_rwl_link(rwl, core_one_wakeup(rwl->obj.queue, E_SUCCESS));
+		return;
+	}
+
+	if ((rwl->mode & rwlPrefMASK) == rwlReaderPref || rwl->obj.queue == 0)
+	{
+		while (core_one_wakeup(rwl->queue, E_SUCCESS))
+			rwl->count++;
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_rwl_takeRead( rwl_t *rwl )
+/* -------------------------------------------------------------------------- */
+{
+	if (rwl->owner == 0 && ((rwl->mode & rwlPrefMASK) == rwlReaderPref || rwl->obj.queue == 0))
+	{
+		rwl->count++;
+		return E_SUCCESS;
+	}
+
+	return E_TIMEOUT;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned rwl_takeRead( rwl_t *rwl )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event;
+
+	assert(rwl);
+	assert(rwl->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		event = priv_rwl_takeRead(rwl);
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned rwl_waitReadFor( rwl_t *rwl, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event;
+
+	assert_tsk_context();
+	assert(rwl);
+	assert(rwl->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		event = priv_rwl_takeRead(rwl);
+
+		if (event == E_TIMEOUT)
+		{
+			priv_rwl_inherit(rwl);
+			event = core_tsk_waitFor(&rwl->queue, delay);
+		}
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned rwl_waitReadUntil( rwl_t *rwl, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event;
+
+	assert_tsk_context();
+	assert(rwl);
+	assert(rwl->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		event = priv_rwl_takeRead(rwl);
+
+		if (event == E_TIMEOUT)
+		{
+			priv_rwl_inherit(rwl);
+			event = core_tsk_waitUntil(&rwl->queue, time);
+		}
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned rwl_giveRead( rwl_t *rwl )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event = E_FAILURE;
+
+	assert(rwl);
+	assert(rwl->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		if (rwl->count > 0)
+		{
+			rwl->count--;
+			priv_rwl_wakeup(rwl);
+			event = E_SUCCESS;
+		}
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_rwl_takeWrite( rwl_t *rwl )
+/* -------------------------------------------------------------------------- */
+{
+	if (rwl->owner == 0 && rwl->count == 0)
+	{
+		core_rwl_link(rwl, System.cur);
+		return E_SUCCESS;
+	}
+
+	if (rwl->owner == System.cur)
+		return E_FAILURE;
+
+	return E_TIMEOUT;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned rwl_takeWrite( rwl_t *rwl )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event;
+
+	assert_tsk_context();
+	assert(rwl);
+	assert(rwl->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		event = priv_rwl_takeWrite(rwl);
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned rwl_waitWriteFor( rwl_t *rwl, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event;
+
+	assert_tsk_context();
+	assert(rwl);
+	assert(rwl->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		event = priv_rwl_takeWrite(rwl);
+
+		if (event == E_TIMEOUT)
+		{
+			priv_rwl_inherit(rwl);
+			event = core_tsk_waitFor(&rwl->obj.queue, delay);
+			if (event == E_TIMEOUT)
+				priv_rwl_wakeup(rwl);
+		}
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned rwl_waitWriteUntil( rwl_t *rwl, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event;
+
+	assert_tsk_context();
+	assert(rwl);
+	assert(rwl->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		event = priv_rwl_takeWrite(rwl);
+
+		if (event == E_TIMEOUT)
+		{
+			priv_rwl_inherit(rwl);
+			event = core_tsk_waitUntil(&rwl->obj.queue, time);
+			if (event == E_TIMEOUT)
+				priv_rwl_wakeup(rwl);
+		}
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned rwl_giveWrite( rwl_t *rwl )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event = E_FAILURE;
+
+	assert_tsk_context();
+	assert(rwl);
+	assert(rwl->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		if (rwl->owner == System.cur)
+		{
+			core_rwl_unlink(rwl);
+			priv_rwl_wakeup(rwl);
+			event = E_SUCCESS;
+		}
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,308 @@
+/******************************************************************************
+
+    @file    StateOS: osrpc.c
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include "inc/osrpc.h"
+#include "inc/ostask.h"
+#include "inc/oscriticalsection.h"
+#include "osalloc.h"
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_rpc_init( rpc_t *rpc )
+/* -------------------------------------------------------------------------- */
+{
+	core_obj_init(&rpc->obj);
+}
+
+/* -------------------------------------------------------------------------- */
+void rpc_init( rpc_t *rpc )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(rpc);
+
+	sys_lock();
+	{
+		memset(rpc, 0, sizeof(rpc_t));
+		priv_rpc_init(rpc);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+rpc_t *rpc_create( void )
+/* -------------------------------------------------------------------------- */
+{
+	rpc_t *rpc;
+
+	assert_tsk_context();
+
+	sys_lock();
+	{
+		rpc = sys_alloc(sizeof(rpc_t));
+		priv_rpc_init(rpc);
+		rpc->obj.res = rpc;
+	}
+	sys_unlock();
+
+	return rpc;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_rpc_reset( rpc_t *rpc, unsigned event )
+/* -------------------------------------------------------------------------- */
+{
+	core_all_wakeup(rpc->obj.queue, event);
+	core_all_wakeup(rpc->server, event);
+	core_all_wakeup(rpc->client, event);
+	core_rpc_unlink(rpc);
+}
+
+/* -------------------------------------------------------------------------- */
+void rpc_reset( rpc_t *rpc )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(rpc);
+	assert(rpc->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_rpc_reset(rpc, E_STOPPED);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void rpc_destroy( rpc_t *rpc )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(rpc);
+	assert(rpc->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_rpc_reset(rpc, rpc->obj.res ? E_DELETED : E_STOPPED);
+		core_res_free(&rpc->obj.res);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+tsk_t **priv_rpc_send( rpc_t *rpc, unsigned *data )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *cur = System.cur;
+	tsk_t *srv = rpc->server;
+
+	cur->tmp.rpc.data = data;
+
+	if (srv == 0 || rpc->owner != 0)
+		return &rpc->obj.queue;
+
+	// the server is waiting for a request: pass the request word directly to it,
+	// lend it the priority of the client and switch to it without scheduling;
+	// the client is not queued yet, so the priority is lent explicitly here
+	*srv->tmp.rpc.data = *data;
+	core_rpc_link(rpc, srv);
+	core_tsk_prio(srv, cur->prio);
+	core_tsk_handoff(srv, E_SUCCESS);
+
+	return &rpc->client;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned rpc_callFor( rpc_t *rpc, unsigned *data, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event = E_TIMEOUT;
+
+	assert_tsk_context();
+	assert(rpc);
+	assert(rpc->obj.res!=RELEASED);
+	assert(data);
+
+	sys_lock();
+	{
+		if (delay != IMMEDIATE)
+			event = core_tsk_waitFor(priv_rpc_send(rpc, data), delay);
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned rpc_callUntil( rpc_t *rpc, unsigned *data, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event = E_TIMEOUT;
+
+	assert_tsk_context();
+	assert(rpc);
+	assert(rpc->obj.res!=RELEASED);
+	assert(data);
+
+	sys_lock();
+	{
+		if ((cnt_t)(time - core_sys_time() - 1) <= ((CNT_MAX)>>1))
+			event = core_tsk_waitUntil(priv_rpc_send(rpc, data), time);
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_rpc_receive( rpc_t *rpc, unsigned *data )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *cli = rpc->obj.queue;
+
+	if (rpc->owner != 0)
+		return E_FAILURE;
+
+	System.cur->tmp.rpc.data = data;
+
+	if (cli == 0)
+		return E_TIMEOUT;
+
+	*data = *cli->tmp.rpc.data;
+	core_tsk_transfer(cli, &rpc->client);
+	core_rpc_link(rpc, System.cur);
+
+	return E_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned rpc_waitFor( rpc_t *rpc, unsigned *data, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event;
+
+	assert_tsk_context();
+	assert(rpc);
+	assert(rpc->obj.res!=RELEASED);
+	assert(data);
+
+	sys_lock();
+	{
+		event = priv_rpc_receive(rpc, data);
+
+		if (event == E_TIMEOUT)
+			event = core_tsk_waitFor(&rpc->server, delay);
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned rpc_waitUntil( rpc_t *rpc, unsigned *data, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event;
+
+	assert_tsk_context();
+	assert(rpc);
+	assert(rpc->obj.res!=RELEASED);
+	assert(data);
+
+	sys_lock();
+	{
+		event = priv_rpc_receive(rpc, data);
+
+		if (event == E_TIMEOUT)
+			event = core_tsk_waitUntil(&rpc->server, time);
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_rpc_dispatch( rpc_t *rpc )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *cli = rpc->obj.queue;
+	tsk_t *srv = rpc->server;
+
+	// another server is waiting while a client has been queued behind the finished call
+	if (cli && srv)
+	{
+		*srv->tmp.rpc.data = *cli->tmp.rpc.data;
+		core_tsk_transfer(cli, &rpc->client);
+		core_rpc_link(rpc, srv);
+		core_tsk_wakeup(srv, E_SUCCESS);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned rpc_reply( rpc_t *rpc, unsigned data )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *cli;
+	unsigned event = E_FAILURE;
+
+	assert_tsk_context();
+	assert(rpc);
+	assert(rpc->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		if (rpc->owner == System.cur)
+		{
+			cli = rpc->client;
+
+			core_rpc_unlink(rpc); // give back the priority lent by the client
+
+			if (cli)
+			{
+				*cli->tmp.rpc.data = data;
+				core_tsk_handoff(cli, E_SUCCESS);
+				event = E_SUCCESS;
+			}
+
+			priv_rpc_dispatch(rpc);
+		}
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
@@ -87,6 +87,7 @@ void priv_sem_reset( sem_t *sem, unsigned event )
 	sem->count = 0;
 
 	core_all_wakeup(sem->obj.queue, event);
+	core_pol_notify(&sem->obj);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -213,6 +214,7 @@ unsigned priv_sem_give( sem_t *sem )
 		return E_FAILURE;
 
 	sem->count++;
+	core_pol_notify(&sem->obj);
 	return E_SUCCESS;
 }
 
@@ -96,6 +96,7 @@ void priv_stm_reset( stm_t *stm, unsigned event )
 	stm->tail  = 0;
 
 	core_all_wakeup(stm->obj.queue, event);
+	core_pol_notify(&stm->obj);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -204,6 +205,9 @@ void priv_stm_putUpdate( stm_t *stm, const char *data, unsigned size )
 		priv_stm_get(stm, stm->obj.queue->tmp.stm.data.in, size);
 		core_one_wakeup(stm->obj.queue, size);
 	}
+
+	if (stm->count > 0)
+		core_pol_notify(&stm->obj);
 }
 
 /* -------------------------------------------------------------------------- */
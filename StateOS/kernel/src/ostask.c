@@ -31,6 +31,7 @@
 
 #include "inc/ostask.h"
 #include "inc/ossignal.h"
+#include "inc/osrpc.h"
 #include "inc/oscriticalsection.h"
 #include "osalloc.h"
 
@@ -69,6 +70,32 @@ void tsk_init( tsk_t *tsk, unsigned prio, fun_t *state, stk_t *stack, unsigned s
 	sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+void tsk_initBasic( tsk_t *tsk, unsigned prio, fun_t *state, stk_t *stack, unsigned size )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(tsk);
+	assert(state);
+	assert(stack);
+	assert(size);
+
+	sys_lock();
+	{
+		memset(tsk, 0, sizeof(tsk_t));
+
+		core_hdr_init(&tsk->hdr);
+
+		tsk->prio  = prio;
+		tsk->basic = prio;
+		tsk->state = state;
+		tsk->stack = stack;
+		tsk->size  = size;
+		tsk->act   = 1;
+	}
+	sys_unlock();
+}
+
 /* -------------------------------------------------------------------------- */
 tsk_t *wrk_create( unsigned prio, fun_t *state, unsigned size )
 /* -------------------------------------------------------------------------- */
@@ -223,9 +250,19 @@ void priv_mtx_remove( tsk_t *tsk )
 {
 	mtx_t *mtx;
 	mtx_t *nxt;
+	rpc_t *rpc;
 
 	tsk->mtx.tree = 0;
 
+	while ((rpc = tsk->rpc.list) != 0)   // clients of the calls being served are released
+	{
+		core_all_wakeup(rpc->client, E_STOPPED);
+		core_rpc_unlink(rpc);
+	}
+
+	while (tsk->rwl.list)                // reader-writer locks held for writing are abandoned
+		core_rwl_unlink(tsk->rwl.list);
+
 	for (mtx = tsk->mtx.list; mtx; mtx = nxt)
 	{
 		nxt = mtx->list;
@@ -461,6 +498,97 @@ unsigned tsk_getPrio( void )
 	return prio;
 }
 
+/* -------------------------------------------------------------------------- */
+void tsk_setDeadline( cnt_t deadline )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+
+	sys_lock();
+	{
+		System.cur->deadline = deadline;
+#if OS_EDF_PRIO
+		if (System.cur->prio == OS_EDF_PRIO)
+			core_ctx_switch();
+#endif
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void tsk_setPeriod( prd_t *prd, cnt_t period, fun_t *hook )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(prd == 0 || period);
+
+	if (prd)
+	{
+		prd->period  = period;
+		prd->release = core_sys_time();
+		prd->hook    = hook;
+		prd->count   = 0;
+		prd->miss    = 0;
+		prd->rsp.min = CNT_MAX;
+		prd->rsp.max = 0;
+		prd->rsp.sum = 0;
+		prd->jit.min = CNT_MAX;
+		prd->jit.max = 0;
+		prd->jit.sum = 0;
+
+		System.cur->deadline = prd->release + period;
+	}
+
+	System.cur->prd = prd;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned tsk_waitNextPeriod( void )
+/* -------------------------------------------------------------------------- */
+{
+	prd_t  * prd = System.cur->prd;
+	cnt_t    rsp;
+	cnt_t    jit;
+	unsigned event = E_SUCCESS;
+
+	assert_tsk_context();
+	assert(prd);
+
+	rsp = core_sys_time() - prd->release;
+
+	prd->count++;
+	if (prd->rsp.min > rsp) prd->rsp.min = rsp;
+	if (prd->rsp.max < rsp) prd->rsp.max = rsp;
+	prd->rsp.sum += rsp;
+
+	if (rsp > prd->period)
+	{
+		prd->miss++;
+		prd->release += (rsp / prd->period) * prd->period;
+		event = E_TIMEOUT;
+
+		if (prd->hook)
+			prd->hook();
+	}
+
+	prd->release += prd->period;
+
+	sys_lock();
+	{
+		System.cur->deadline = prd->release + prd->period;
+		core_tsk_waitUntil(&System.dly, prd->release);
+	}
+	sys_unlock();
+
+	jit = core_sys_time() - prd->release;
+
+	if (prd->jit.min > jit) prd->jit.min = jit;
+	if (prd->jit.max < jit) prd->jit.max = jit;
+	prd->jit.sum += jit;
+
+	return event;
+}
+
 /* -------------------------------------------------------------------------- */
 void tsk_sleepFor( cnt_t delay )
 /* -------------------------------------------------------------------------- */
@@ -472,6 +600,34 @@ void tsk_sleepFor( cnt_t delay )
 	sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+void tsk_sleepForUs( uint32_t usec )
+/* -------------------------------------------------------------------------- */
+{
+#if HW_TIMER_SIZE == 0
+	uint32_t phase = port_sys_usec(); // time elapsed since the last system tick
+	uint32_t start = core_sys_hrtime();
+	cnt_t    delay;
+
+	if (usec == 0)
+		return;
+
+	// sleep until the last system tick before the end of the delay
+	delay = core_usec_tck(usec + phase) - 1;
+	if (delay > 0)
+		tsk_sleepFor(delay);
+
+	// spin for the rest of the delay, which is shorter than one system tick
+	while (core_sys_hrtime() - start < usec)
+		tsk_yield();
+#else
+	cnt_t    delay = core_usec_tck(usec);
+
+	if (delay > 0)
+		tsk_sleepFor(delay);
+#endif
+}
+
 /* -------------------------------------------------------------------------- */
 void tsk_sleepNext( cnt_t delay )
 /* -------------------------------------------------------------------------- */
@@ -542,6 +698,36 @@ unsigned tsk_resume( tsk_t *tsk )
 	return event;
 }
 
+/* -------------------------------------------------------------------------- */
+unsigned tsk_activate( tsk_t *tsk )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event = E_SUCCESS;
+
+	assert(tsk);
+	assert(tsk->hdr.obj.res!=RELEASED);
+	assert(tsk->state);
+	assert(tsk->act); // only basic tasks can be activated
+
+	sys_lock();
+	{
+		if (tsk->hdr.id == ID_STOPPED)
+		{
+			tsk->act = 1;
+			core_ctx_init(tsk);
+			core_tsk_insert(tsk);
+		}
+		else
+		if (tsk->act + 1 != 0)
+			tsk->act++;
+		else
+			event = E_FAILURE;
+	}
+	sys_unlock();
+
+	return event;
+}
+
 /* -------------------------------------------------------------------------- */
 static
 void priv_sig_handler( tsk_t *tsk )
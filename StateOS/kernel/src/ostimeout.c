@@ -0,0 +1,111 @@
+/******************************************************************************
+
+    @file    StateOS: ostimeout.c
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "inc/ostimeout.h"
+#include "inc/oscriticalsection.h"
+
+/* -------------------------------------------------------------------------- */
+void tmo_init( tmo_t *tmo, cbk_t *fun, void *arg )
+/* -------------------------------------------------------------------------- */
+{
+	assert(tmo);
+
+	sys_lock();
+	{
+		memset(tmo, 0, sizeof(tmo_t));
+
+		tmo->fun = fun;
+		tmo->arg = arg;
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_tmo_start( tmo_t *tmo, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	if (tmo->next)
+		core_tmo_remove(tmo);
+
+	tmo->time = time;
+	core_tmo_insert(tmo);
+}
+
+/* -------------------------------------------------------------------------- */
+void tmo_start( tmo_t *tmo, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	assert(tmo);
+	assert(delay <= ((CNT_MAX)>>1));
+
+	sys_lock();
+	{
+		priv_tmo_start(tmo, core_sys_time() + delay);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void tmo_startUntil( tmo_t *tmo, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert(tmo);
+
+	sys_lock();
+	{
+		priv_tmo_start(tmo, time);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned tmo_stop( tmo_t *tmo )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned event = E_FAILURE;
+
+	assert(tmo);
+
+	sys_lock();
+	{
+		if (tmo->next)
+		{
+			core_tmo_remove(tmo);
+			event = E_SUCCESS;
+		}
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
@@ -77,18 +77,6 @@ tmr_t *tmr_create( fun_t *state )
 	return tmr;
 }
 
-/* -------------------------------------------------------------------------- */
-static
-void priv_tmr_reset( tmr_t *tmr, unsigned event )
-/* -------------------------------------------------------------------------- */
-{
-	if (tmr->hdr.id == ID_TIMER)
-	{
-		core_all_wakeup(tmr->hdr.obj.queue, event);
-		core_tmr_remove(tmr);
-	}
-}
-
 /* -------------------------------------------------------------------------- */
 void tmr_reset( tmr_t *tmr )
 /* -------------------------------------------------------------------------- */
@@ -99,7 +87,7 @@ void tmr_reset( tmr_t *tmr )
 
 	sys_lock();
 	{
-		priv_tmr_reset(tmr, E_STOPPED);
+		core_tmr_reset(tmr, E_STOPPED);
 	}
 	sys_unlock();
 }
@@ -114,7 +102,7 @@ void tmr_destroy( tmr_t *tmr )
 
 	sys_lock();
 	{
-		priv_tmr_reset(tmr, tmr->hdr.obj.res ? E_DELETED : E_STOPPED);
+		core_tmr_reset(tmr, tmr->hdr.obj.res ? E_DELETED : E_STOPPED);
 		core_res_free(&tmr->hdr.obj.res);
 	}
 	sys_unlock();
@@ -207,6 +195,58 @@ void tmr_startUntil( tmr_t *tmr, cnt_t time )
 	sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+void tmr_setSlack( tmr_t *tmr, cnt_t slack )
+/* -------------------------------------------------------------------------- */
+{
+	assert(tmr);
+	assert(tmr->hdr.obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		tmr->slack = slack;
+	}
+	sys_unlock();
+}
+
+#if OS_TIMER_QUEUE > 0
+
+/* -------------------------------------------------------------------------- */
+void tmr_setDeferred( tmr_t *tmr, bool deferred )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(tmr);
+	assert(tmr->hdr.obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		tmr->defer = deferred;
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned tmr_getOverrun( tmr_t *tmr )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned overrun;
+
+	assert(tmr);
+	assert(tmr->hdr.obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		overrun = tmr->overrun;
+		tmr->overrun = 0;
+	}
+	sys_unlock();
+
+	return overrun;
+}
+
+#endif//OS_TIMER_QUEUE
+
 /* -------------------------------------------------------------------------- */
 static
 unsigned priv_tmr_take( tmr_t *tmr )
@@ -0,0 +1,226 @@
+/******************************************************************************
+
+    @file    StateOS: ostimergroup.c
+    @author  Rajmund Szymanski
+    @date    18.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "inc/ostimergroup.h"
+#include "inc/oscriticalsection.h"
+#include "osalloc.h"
+
+/* -------------------------------------------------------------------------- */
+static
+hdr_t *priv_tmg_list( tmg_t *tmg )
+/* -------------------------------------------------------------------------- */
+{
+	hdr_t *lst = &tmg->lst;
+
+	if (lst->next == 0) // statically initialized list
+		lst->prev = lst->next = lst;
+
+	return lst;
+}
+
+/* -------------------------------------------------------------------------- */
+void tmg_handler( void )
+/* -------------------------------------------------------------------------- */
+{
+	tmg_t *tmg = (tmg_t *) tmr_thisISR();
+	tmr_t *tmr;
+	tmr_t *nxt;
+
+	sys_lock();
+	{
+		for (tmr = priv_tmg_list(tmg)->next; tmr != (void *) &tmg->lst; tmr = nxt)
+		{
+			nxt = tmr->hdr.next; // the callback procedure may move the timer out of the group (e.g. restart it)
+
+			core_tmr_launch(tmr);
+			core_all_wakeup(tmr->hdr.obj.queue, E_SUCCESS);
+			core_pol_notify(&tmr->hdr.obj);
+		}
+
+		System.tmr = &tmg->tmr;
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_tmg_init( tmg_t *tmg )
+/* -------------------------------------------------------------------------- */
+{
+	core_hdr_init(&tmg->tmr.hdr);
+
+	tmg->tmr.state = tmg_handler;
+
+	priv_tmg_list(tmg);
+}
+
+/* -------------------------------------------------------------------------- */
+void tmg_init( tmg_t *tmg )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(tmg);
+
+	sys_lock();
+	{
+		memset(tmg, 0, sizeof(tmg_t));
+		priv_tmg_init(tmg);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+tmg_t *tmg_create( void )
+/* -------------------------------------------------------------------------- */
+{
+	tmg_t *tmg;
+
+	assert_tsk_context();
+
+	sys_lock();
+	{
+		tmg = sys_alloc(sizeof(tmg_t));
+		priv_tmg_init(tmg);
+		tmg->tmr.hdr.obj.res = tmg;
+	}
+	sys_unlock();
+
+	return tmg;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_tmg_reset( tmg_t *tmg, unsigned event )
+/* -------------------------------------------------------------------------- */
+{
+	hdr_t *lst = priv_tmg_list(tmg);
+
+	core_tmr_reset(&tmg->tmr, event);
+
+	while (lst->next != lst)
+		core_tmr_reset(lst->next, E_STOPPED);
+}
+
+/* -------------------------------------------------------------------------- */
+void tmg_reset( tmg_t *tmg )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(tmg);
+	assert(tmg->tmr.hdr.obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_tmg_reset(tmg, E_STOPPED);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void tmg_destroy( tmg_t *tmg )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(tmg);
+	assert(tmg->tmr.hdr.obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_tmg_reset(tmg, tmg->tmr.hdr.obj.res ? E_DELETED : E_STOPPED);
+		core_res_free(&tmg->tmr.hdr.obj.res);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void tmg_insert( tmg_t *tmg, tmr_t *tmr )
+/* -------------------------------------------------------------------------- */
+{
+	hdr_t *lst;
+	hdr_t *prv;
+
+	assert_tsk_context();
+	assert(tmg);
+	assert(tmg->tmr.hdr.obj.res!=RELEASED);
+	assert(tmr);
+	assert(tmr->hdr.obj.res!=RELEASED);
+	assert(tmr != &tmg->tmr);
+
+	sys_lock();
+	{
+		if (tmr->hdr.id == ID_TIMER)
+			core_tmr_remove(tmr);
+
+		lst = priv_tmg_list(tmg);
+		prv = lst->prev;
+
+		tmr->hdr.prev = prv;
+		tmr->hdr.next = lst;
+		tmr->hdr.id   = ID_TIMER;
+		lst->prev = tmr;
+		prv->next = tmr;
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned tmg_remove( tmg_t *tmg, tmr_t *tmr )
+/* -------------------------------------------------------------------------- */
+{
+	hdr_t  * lst;
+	hdr_t  * nxt;
+	unsigned event = E_FAILURE;
+
+	assert_tsk_context();
+	assert(tmg);
+	assert(tmg->tmr.hdr.obj.res!=RELEASED);
+	assert(tmr);
+
+	sys_lock();
+	{
+		lst = priv_tmg_list(tmg);
+
+		for (nxt = lst->next; nxt != lst; nxt = nxt->next)
+		{
+			if (nxt == &tmr->hdr)
+			{
+				core_tmr_reset(tmr, E_STOPPED);
+				event = E_SUCCESS;
+				break;
+			}
+		}
+	}
+	sys_unlock();
+
+	return event;
+}
+
+/* -------------------------------------------------------------------------- */
@@ -200,16 +200,22 @@ void WTIMER0A_Handler( void )
 cnt_t port_sys_time( void )
 {
 	cnt_t    cnt;
+	cnt_t    gen;
 	uint32_t tck;
 
-	cnt = System.cnt;
-	tck = -WTIMER0->TAV;
-
-	if (WTIMER0->MIS & TIMER_MIS_TATOMIS)
+	do
 	{
+		gen = core_sys_cnt();
+		cnt = gen;
 		tck = -WTIMER0->TAV;
-		cnt += (cnt_t)(1) << (HW_TIMER_SIZE);
+
+		if (WTIMER0->MIS & TIMER_MIS_TATOMIS)
+		{
+			tck = -WTIMER0->TAV;
+			cnt += (cnt_t)(1) << (HW_TIMER_SIZE);
+		}
 	}
+	while (gen != core_sys_cnt());
 
 	return cnt + tck;
 }
@@ -106,6 +106,25 @@ uint32_t port_sys_time( void )
 
 #endif
 
+/* -------------------------------------------------------------------------- */
+// return time elapsed since the last system tick (in microseconds)
+// a pending (not yet handled) tick interrupt is taken into account
+
+#if HW_TIMER_SIZE == 0
+
+__STATIC_INLINE
+uint32_t port_sys_usec( void )
+{
+	uint32_t tck = SysTick->LOAD - SysTick->VAL;
+
+	if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+		tck = SysTick->LOAD - SysTick->VAL + SysTick->LOAD + 1;
+
+	return (uint32_t)((uint64_t)tck * 1000000 / ((uint64_t)(OS_FREQUENCY) * (SysTick->LOAD + 1)));
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 // force yield system control to the next process
 
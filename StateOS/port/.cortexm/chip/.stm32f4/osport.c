@@ -199,16 +199,22 @@ void TIM2_IRQHandler( void )
 cnt_t port_sys_time( void )
 {
 	cnt_t    cnt;
+	cnt_t    gen;
 	uint32_t tck;
 
-	cnt = System.cnt;
-	tck = TIM2->CNT;
-
-	if (TIM2->SR & TIM_SR_UIF)
+	do
 	{
+		gen = core_sys_cnt();
+		cnt = gen;
 		tck = TIM2->CNT;
-		cnt += (cnt_t)(1) << (HW_TIMER_SIZE);
+
+		if (TIM2->SR & TIM_SR_UIF)
+		{
+			tck = TIM2->CNT;
+			cnt += (cnt_t)(1) << (HW_TIMER_SIZE);
+		}
 	}
+	while (gen != core_sys_cnt());
 
 	return cnt + tck;
 }
@@ -73,18 +73,12 @@ extern "C" {
 /* -------------------------------------------------------------------------- */
 
 #ifndef OS_FUNCTIONAL
-
-#if   defined(__ARMCOMPILER_VERSION)
-#define OS_FUNCTIONAL         6
-#elif defined(__GNUC__)
-#define OS_FUNCTIONAL         4
-#else
-#define OS_FUNCTIONAL         0 /* c++ functional library header not included */
+#define OS_FUNCTIONAL         4 /* size of c++ inline delegate (in pointers)  */
 #endif
 
-#elif   OS_FUNCTIONAL
-#error  OS_FUNCTIONAL is an internal port definition!
-#endif//OS_FUNCTIONAL
+#if     OS_FUNCTIONAL == 1
+#error  osconfig.h: Incorrect OS_FUNCTIONAL value!
+#endif
 
 /* -------------------------------------------------------------------------- */
 
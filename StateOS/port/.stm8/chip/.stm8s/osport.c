@@ -201,16 +201,22 @@ INTERRUPT_HANDLER(TIM3_CAP_COM_IRQHandler, 16)
 cnt_t port_sys_time( void )
 {
 	cnt_t    cnt;
+	cnt_t    gen;
 	uint16_t tck;
 
-	cnt = System.cnt;
-	tck = ((uint16_t)TIM3->CNTRH << 8) | TIM3->CNTRL;
-
-	if (TIM3->SR1 & TIM3_SR1_UIF)
+	do
 	{
+		gen = core_sys_cnt();
+		cnt = gen;
 		tck = ((uint16_t)TIM3->CNTRH << 8) | TIM3->CNTRL;
-		cnt += (cnt_t)(1) << (HW_TIMER_SIZE);
+
+		if (TIM3->SR1 & TIM3_SR1_UIF)
+		{
+			tck = ((uint16_t)TIM3->CNTRH << 8) | TIM3->CNTRL;
+			cnt += (cnt_t)(1) << (HW_TIMER_SIZE);
+		}
 	}
+	while (gen != core_sys_cnt());
 
 	return cnt + tck;
 }
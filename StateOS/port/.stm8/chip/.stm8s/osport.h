@@ -95,6 +95,30 @@ uint16_t port_sys_time( void )
 
 #endif
 
+/* -------------------------------------------------------------------------- */
+// return time elapsed since the last system tick (in microseconds)
+// a pending (not yet handled) tick interrupt is taken into account
+
+#if HW_TIMER_SIZE == 0
+
+__STATIC_INLINE
+uint32_t port_sys_usec( void )
+{
+	uint16_t arr = ((uint16_t)TIM3->ARRH << 8) | TIM3->ARRL;
+	uint32_t tck = ((uint16_t)TIM3->CNTRH << 8) | TIM3->CNTRL;
+
+	if (TIM3->SR1 & TIM3_SR1_UIF)
+		tck = (((uint16_t)TIM3->CNTRH << 8) | TIM3->CNTRL) + (uint32_t)arr + 1;
+
+#if 1000000 % (OS_FREQUENCY) == 0
+	return tck * (1000000/(OS_FREQUENCY)) / ((uint32_t)arr + 1);
+#else
+	return tck * 1000 / ((uint32_t)arr + 1) * 1000 / (OS_FREQUENCY);
+#endif
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 // force yield system control to the next process
 
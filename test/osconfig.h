@@ -60,6 +60,14 @@
 // default value: 0 (the same as priority of idle process)
 #define OS_MAIN_PRIO          0
 
+// ----------------------------
+// size of the c++ inline delegate used by tasks, timers and job queues (in pointers)
+// OS_FUNCTIONAL == 0 => c++ wrappers use plain function pointers
+// OS_FUNCTIONAL >  1 => c++ wrappers accept callable objects (lambdas with captures) of size up to (OS_FUNCTIONAL - 1) pointers, without dynamic allocation
+//                      callable objects must be trivially copyable (e.g. lambdas capturing only pointers and plain values)
+// default value: 4 (cortex-m), 0 (stm8)
+// #define OS_FUNCTIONAL
+
 // ----------------------------
 // os heap size in bytes
 // OS_HEAP_SIZE == 0 => functions 'xxx_create' use 'malloc' provided with the compiler libraries
@@ -82,3 +90,50 @@
 // available values: 16, 32, 64
 // default value: 32
 #define OS_TIMER_SIZE        32
+
+// ----------------------------
+// size of the queue of the timer service task
+// OS_TIMER_QUEUE == 0 => timer callback procedures are always launched from the timer interrupt
+// OS_TIMER_QUEUE >  0 => callback procedures of deferred timers are launched by the timer service task, OS_TIMER_QUEUE indicates maximum number of deferred timers
+// default value: 0
+// #define OS_TIMER_QUEUE
+
+// ----------------------------
+// priority of the timer service task
+// default value: UINT_MAX
+// #define OS_TIMER_PRIO
+
+// ----------------------------
+// timer service task stack size in bytes
+// default value: OS_STACK_SIZE
+// #define OS_TIMER_STACK
+
+// ----------------------------
+// maximum number of timers and timeouts handled in one invocation of the timers queue handler
+// OS_TIMER_BUDGET == 0 => all expired timers are handled at once
+// OS_TIMER_BUDGET >  0 => the rest of expired timers is handled in the next invocation (tick-less mode: immediately, tick mode: in the next tick)
+// default value: 0
+// #define OS_TIMER_BUDGET
+
+// ----------------------------
+// priority of the earliest-deadline-first (EDF) band
+// ready tasks with this priority are ordered by their absolute deadlines
+// tasks with other priorities are scheduled above or below the band by fixed priorities
+// OS_EDF_PRIO == 0 => EDF scheduling disabled
+// default value: 0
+// #define OS_EDF_PRIO
+
+// ----------------------------
+// number of wait queues in the futex hash table
+// default value: 8
+// #define OS_FUTEX_QUEUES
+
+// ----------------------------
+// extended test configuration
+// the test suite is built with the default values of the options above;
+// define TEST_EXTENDED (e.g. add it to DEFS in the makefile) to run it once more
+// with the deferred timer callbacks and the earliest-deadline-first band enabled
+#ifdef  TEST_EXTENDED
+#define OS_TIMER_QUEUE        4
+#define OS_EDF_PRIO           6
+#endif
@@ -1,7 +1,7 @@
 #include "test.h"
 
 #define       LOOP 1
-#define       SIZE 66
+#define       SIZE 123
 
 static cnt_t  summary = 0;
 static fun_t *test[SIZE];
@@ -52,6 +52,7 @@ int main()
 	
 	TEST_AddUnit(test_alloc);
 	TEST_AddUnit(test_spin_lock);
+	TEST_AddUnit(test_sequence_lock);
 	TEST_AddUnit(test_once_flag);
 	TEST_AddUnit(test_event);
 	TEST_AddUnit(test_signal);
@@ -61,14 +62,23 @@ int main()
 	TEST_AddUnit(test_mutex);
 	TEST_AddUnit(test_fast_mutex);
 	TEST_AddUnit(test_condition_variable);
+	TEST_AddUnit(test_reader_writer_lock);
 	TEST_AddUnit(test_memory_pool);
 	TEST_AddUnit(test_stream_buffer);
 	TEST_AddUnit(test_message_buffer);
 	TEST_AddUnit(test_mailbox_queue);
+	TEST_AddUnit(test_channel);
 	TEST_AddUnit(test_event_queue);
 	TEST_AddUnit(test_job_queue);
+	TEST_AddUnit(test_executor);
+	TEST_AddUnit(test_rpc);
 	TEST_AddUnit(test_timer);
+	TEST_AddUnit(test_timer_group);
+	TEST_AddUnit(test_timeout);
 	TEST_AddUnit(test_task);
+	TEST_AddUnit(test_poll);
+	TEST_AddUnit(test_futex);
+	TEST_AddUnit(test_coroutine);
 
 	for (i = 0; i < count * LOOP; i++)
 	{
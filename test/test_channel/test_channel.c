@@ -0,0 +1,10 @@
+#include "test.h"
+
+void test_channel()
+{
+	UNIT_Notify();
+#ifndef __CSMC__
+	TEST_Add(test_channel_1);
+	TEST_Add(test_channel_2);
+#endif
+}
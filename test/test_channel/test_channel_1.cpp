@@ -0,0 +1,42 @@
+#include "test.h"
+
+static Channel<2, unsigned> Chn;
+
+static unsigned sent;
+
+static void proc()
+{
+	unsigned received;
+	unsigned event;
+
+	event = Chn.wait(received);                  ASSERT_success(event);
+	                                             ASSERT(received == sent);
+	        ThisTask::stop();
+}
+
+static void test()
+{
+	unsigned received;
+	unsigned event;
+		                                         ASSERT(!Tsk1);
+	        Tsk1.startFrom(proc);                ASSERT(!!Tsk1);
+	event = Chn.give(sent = rand());             ASSERT_success(event);
+	event = Tsk1.join();                         ASSERT_success(event);
+	event = Chn.tryWait(received);               ASSERT_timeout(event);
+	event = Chn.give(1U);                        ASSERT_success(event);
+	event = Chn.send(2U);                        ASSERT_success(event);
+	                                             ASSERT(Chn.space() == 0);
+	event = Chn.sendFor(2, 3U);                  ASSERT_timeout(event);
+	event = Chn.take(received);                  ASSERT_success(event);
+	                                             ASSERT(received == 1);
+	event = Chn.waitFor(received, 2);            ASSERT_success(event);
+	                                             ASSERT(received == 2);
+	event = Chn.waitFor(received, 2);            ASSERT_timeout(event);
+}
+
+extern "C"
+void test_channel_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,54 @@
+#include "test.h"
+#include <functional>
+
+static int live = 0;
+
+struct Mail // move-only mail
+{
+	unsigned *data;
+
+	Mail( unsigned *_data = nullptr ): data(_data)  { live++; }
+	Mail( Mail&& _mail ): data(_mail.data)          { live++; _mail.data = nullptr; }
+	Mail& operator=( Mail&& _mail )                 { data = _mail.data; _mail.data = nullptr; return *this; }
+	Mail( const Mail& ) = delete;
+	~Mail( void )                                   { live--; }
+};
+
+static Channel<2, Mail> Chn;
+static Channel<1, std::function<unsigned( void )>> Fun;
+
+static unsigned sent;
+
+static void proc()
+{
+	unsigned event;
+	{
+	Mail     received;
+	event = Chn.wait(received);                  ASSERT_success(event);
+	                                             ASSERT(received.data == &sent);
+	unsigned*data = received.data;
+	event = Fun.give([data]{ return *data; });   ASSERT_success(event);
+	}
+	        ThisTask::stop();
+}
+
+static void test()
+{
+	std::function<unsigned( void )> fun;
+	unsigned event;
+		                                         ASSERT(!Tsk1);
+	        Tsk1.startFrom(proc);                ASSERT(!!Tsk1);
+	        sent = rand();
+	event = Chn.emplace(&sent);                  ASSERT_success(event);
+	event = Tsk1.join();                         ASSERT_success(event);
+	                                             ASSERT(live == 0);
+	event = Fun.take(fun);                       ASSERT_success(event);
+	                                             ASSERT(fun() == sent);
+}
+
+extern "C"
+void test_channel_2()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -4,8 +4,10 @@ void test_condition_variable()
 {
 	UNIT_Notify();
 	TEST_Add(test_condition_variable_1);
+	TEST_Add(test_condition_variable_5);
 #ifndef __CSMC__
 	TEST_Add(test_condition_variable_2);
 	TEST_Add(test_condition_variable_3);
+	TEST_Add(test_condition_variable_4);
 #endif
 }
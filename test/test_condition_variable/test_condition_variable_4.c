@@ -0,0 +1,48 @@
+#include "test.h"
+
+#define WAITERS 16
+
+static_MTX(mtx3, mtxPrioInherit, 0);
+static_CND(cnd3);
+
+static tsk_t    wrk[WAITERS];
+static stk_t    stk[WAITERS][STK_SIZE(OS_STACK_SIZE)];
+static unsigned cnt;
+
+static void proc()
+{
+	unsigned event;
+
+	event = mtx_wait(mtx3);                      ASSERT_success(event);
+	event = cnd_wait(cnd3, mtx3);                ASSERT_success(event);
+	        cnt++;
+	event = mtx_give(mtx3);                      ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+	unsigned i;
+
+	cnt = 0;
+	for (i = 0; i < WAITERS; i++)
+	{
+	        tsk_init(&wrk[i], 1, proc, stk[i], sizeof(stk[i]));
+	                                             ASSERT_ready(&wrk[i]);
+	}
+	event = mtx_wait(mtx3);                      ASSERT_success(event);
+	        cnd_give(cnd3, cndAll);              ASSERT(cnt == 0);
+	event = mtx_give(mtx3);                      ASSERT(cnt == WAITERS);
+	                                             ASSERT_success(event);
+	for (i = 0; i < WAITERS; i++)
+	{
+	event = tsk_join(&wrk[i]);                   ASSERT_success(event);
+	}
+}
+
+void test_condition_variable_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,33 @@
+#include "test.h"
+
+static_MTX(mtx5, mtxDefault);
+static_CND(cnd5);
+
+static void proc1()
+{
+	unsigned event;
+
+	event = mtx_wait(mtx5);                      ASSERT_success(event);
+	event = cnd_waitFor(cnd5, mtx5, 2);          ASSERT_success(event); // signalled before the timeout
+	                                             ASSERT(mtx5->owner == tsk1);
+	event = mtx_give(mtx5);                      ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+	                                             ASSERT_dead(tsk1);
+	        tsk_startFrom(tsk1, proc1);          ASSERT_ready(tsk1);
+	event = mtx_wait(mtx5);                      ASSERT_success(event);
+	        cnd_give(cnd5, cndOne);              ASSERT(tsk1->guard == &mtx5->obj.queue);
+	        tsk_delay(5);                        ASSERT(tsk1->guard == &mtx5->obj.queue); // the mutex is held longer than the timeout
+	event = mtx_give(mtx5);                      ASSERT_success(event);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+}
+
+void test_condition_variable_5()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,66 @@
+#include "test.h"
+
+#if defined(__cpp_impl_coroutine)
+
+static auto Sch = CoSchedulerT<4, 256>();
+static auto Sem = Semaphore(0);
+static auto Mtx = CoMutex();
+
+static int counter;
+
+static Coroutine consumer( CoScheduler & )
+{
+	unsigned event;
+
+	event = co_await Sem;                        ASSERT_success(event);
+	        co_await Mtx.lock();
+	        counter++;
+	        co_await ThisCoroutine::yield();     ASSERT(counter == 1 || counter == 2);
+	        Mtx.unlock();
+}
+
+static Coroutine producer( CoScheduler & )
+{
+	unsigned event;
+
+	event = co_await ThisCoroutine::waitFor(Sem, 1);
+	                                             ASSERT_timeout(event);
+	event = co_await ThisCoroutine::sleepFor(1); ASSERT_timeout(event);
+	event = co_await ThisCoroutine::sleepUntil(sys_time() - 1);
+	                                             ASSERT_timeout(event);
+	        Sem.give();
+}
+
+static void proc()
+{
+	        ThisTask::sleepFor(3);
+	        Sem.give();
+	        ThisTask::stop();
+}
+
+static void test()
+{
+	        counter = 0;
+	                                             ASSERT(!Tsk1);
+	        Tsk1.startFrom(proc);                ASSERT(!!Tsk1);
+	        ASSERT(!!consumer(Sch));
+	        ASSERT(!!consumer(Sch));
+	        ASSERT(!!producer(Sch));             ASSERT(Sch.count() == 3);
+	        ASSERT(Sch.run() == 0);              ASSERT(counter == 2);
+	        Tsk1.join();
+}
+
+#else
+
+static void test()
+{
+}
+
+#endif
+
+extern "C"
+void test_coroutine_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
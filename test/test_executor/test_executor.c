@@ -0,0 +1,11 @@
+#include "test.h"
+
+void test_executor()
+{
+	UNIT_Notify();
+	TEST_Add(test_executor_1);
+#ifndef __CSMC__
+	TEST_Add(test_executor_2);
+	TEST_Add(test_executor_3);
+#endif
+}
@@ -0,0 +1,42 @@
+#include "test.h"
+
+static_SEM(done, 0, semCounting);
+
+static int counter;
+static int one   = 1;
+static int two   = 2;
+static int three = 3;
+
+static void proc( void *arg )
+{
+	        sys_lock();
+	        {
+		        counter += *(int *)arg;
+	        }
+	        sys_unlock();
+}
+
+static void test()
+{
+	unsigned event;
+	exe_t  * exe;
+	        counter = 0;
+	        exe = exe_create(2, 1, 2);           ASSERT(exe);
+	event = exe_give(exe, proc, &one, 0);        ASSERT_success(event);
+	event = exe_send(exe, proc, &two, done);     ASSERT_success(event);
+	event = sem_wait(done);                      ASSERT_success(event);
+	                                             ASSERT(counter >= 2);
+	event = exe_give(exe, proc, &three, done);   ASSERT_success(event);
+	event = exe_wait(exe);                       ASSERT_success(event);
+	                                             ASSERT(counter == 6);
+	                                             ASSERT(exe_count(exe) == 0);
+	event = sem_take(done);                      ASSERT_success(event);
+	event = exe_waitFor(exe, 0);                 ASSERT_success(event);
+	        exe_destroy(exe);
+}
+
+void test_executor_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
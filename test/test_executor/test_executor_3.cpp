@@ -0,0 +1,40 @@
+#include "test.h"
+
+static auto Done = Semaphore(0);
+
+static int counter;
+static int one   = 1;
+static int two   = 2;
+static int three = 3;
+
+static void proc( void *arg )
+{
+	CriticalSection cs;
+
+	        counter += *static_cast<int *>(arg);
+}
+
+static void test()
+{
+	unsigned event;
+	        counter = 0;
+	auto    exe = Executor::create(2, 1, 2);     ASSERT(exe);
+	event = exe->give(proc, &one);               ASSERT_success(event);
+	event = exe->send(proc, &two, &Done);        ASSERT_success(event);
+	event = Done.wait();                         ASSERT_success(event);
+	                                             ASSERT(counter >= 2);
+	event = exe->give(proc, &three, &Done);      ASSERT_success(event);
+	event = exe->wait();                         ASSERT_success(event);
+	                                             ASSERT(counter == 6);
+	                                             ASSERT(exe->count() == 0);
+	event = Done.take();                         ASSERT_success(event);
+	event = exe->waitFor(0);                     ASSERT_success(event);
+	        exe->destroy();
+}
+
+extern "C"
+void test_executor_3()
+{
+	TEST_Notify();
+	TEST_Call();
+}
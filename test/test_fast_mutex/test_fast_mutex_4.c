@@ -0,0 +1,34 @@
+#include "test.h"
+
+static void proc1()
+{
+	unsigned event;
+
+	event = mut_take(mut1);                      ASSERT_timeout(event);
+	event = mut_wait(mut1);                      ASSERT_success(event);
+	event = mut_give(mut1);                      ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+
+	event = mut_take(mut1);                      ASSERT_success(event);
+	event = mut_give(mut1);                      ASSERT_success(event);
+	event = mut_wait(mut1);                      ASSERT_success(event);
+	event = mut_take(mut1);                      ASSERT_failure(event);
+	event = mut_give(mut1);                      ASSERT_success(event);
+	event = mut_give(mut1);                      ASSERT_failure(event);
+	event = mut_wait(mut1);                      ASSERT_success(event);
+	                                             ASSERT_dead(tsk1);
+	        tsk_startFrom(tsk1, proc1);
+	event = mut_give(mut1);                      ASSERT_success(event);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+}
+
+void test_fast_mutex_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
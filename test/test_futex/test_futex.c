@@ -0,0 +1,11 @@
+#include "test.h"
+
+void test_futex()
+{
+	UNIT_Notify();
+	TEST_Add(test_futex_1);
+#ifndef __CSMC__
+	TEST_Add(test_futex_2);
+	TEST_Add(test_futex_3);
+#endif
+}
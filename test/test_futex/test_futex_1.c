@@ -0,0 +1,38 @@
+#include "test.h"
+
+static volatile unsigned value;
+
+static void proc()
+{
+	unsigned event;
+
+	event = fut_wait(&value, 0);                 ASSERT_success(event);
+	                                             ASSERT(value == 1);
+	event = fut_wait(&value, 0);                 ASSERT_failure(event);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+	unsigned count;
+
+	        value = 0;
+	                                             ASSERT_dead(tsk1);
+	        tsk_startFrom(tsk1, proc);           ASSERT_ready(tsk1);
+	                                             ASSERT_dead(tsk2);
+	        tsk_startFrom(tsk2, proc);           ASSERT_ready(tsk2);
+	event = fut_waitFor(&value, 0, IMMEDIATE);   ASSERT_timeout(event);
+	event = fut_waitFor(&value, 1, IMMEDIATE);   ASSERT_failure(event);
+	        value = 1;
+	count = fut_wake(&value, UINT_MAX);          ASSERT(count == 2);
+	event = tsk_join(tsk2);                      ASSERT_success(event);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+	count = fut_wake(&value, UINT_MAX);          ASSERT(count == 0);
+}
+
+void test_futex_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
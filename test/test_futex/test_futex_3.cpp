@@ -0,0 +1,40 @@
+#include "test.h"
+
+static Futex Fut;
+
+static void proc()
+{
+	unsigned event;
+
+	event = Fut.wait(0);                         ASSERT_success(event);
+	                                             ASSERT(Fut == 1);
+	event = Fut.wait(0);                         ASSERT_failure(event);
+	        ThisTask::stop();
+}
+
+static void test()
+{
+	unsigned event;
+	unsigned count;
+
+	        Fut = 0;
+	                                             ASSERT(!Tsk1);
+	        Tsk1.startFrom(proc);                ASSERT(!!Tsk1);
+	                                             ASSERT(!Tsk2);
+	        Tsk2.startFrom(proc);                ASSERT(!!Tsk2);
+	event = Fut.waitFor(0, IMMEDIATE);           ASSERT_timeout(event);
+	event = Fut.waitFor(1, IMMEDIATE);           ASSERT_failure(event);
+	        Fut = 1;
+	count = Fut.notify_one();                    ASSERT(count == 1);
+	count = Fut.notify_all();                    ASSERT(count == 1);
+	event = Tsk2.join();                         ASSERT_success(event);
+	event = Tsk1.join();                         ASSERT_success(event);
+	count = Fut.notify_all();                    ASSERT(count == 0);
+}
+
+extern "C"
+void test_futex_3()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -4,8 +4,13 @@ void test_job_queue()
 {
 	UNIT_Notify();
 	TEST_Add(test_job_queue_1);
+	TEST_Add(test_job_queue_4);
 #ifndef __CSMC__
 	TEST_Add(test_job_queue_2);
 	TEST_Add(test_job_queue_3);
+	TEST_Add(test_job_queue_5);
+#if OS_FUNCTIONAL
+	TEST_Add(test_job_queue_6);
+#endif
 #endif
 }
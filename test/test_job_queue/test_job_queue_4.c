@@ -0,0 +1,70 @@
+#include "test.h"
+
+static_JOB(job4, 4);
+
+static unsigned sequence;
+static unsigned digit[] = { 0, 1, 2, 3, 4, 5 };
+
+static void proc( void *arg )
+{
+	        sequence = sequence * 10 + *(unsigned *)arg;
+}
+
+static void plain()
+{
+	        sequence = sequence * 10 + 9;
+}
+
+static void proc1()
+{
+	unsigned event;
+
+	event = job_wait(job4);                      ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+	jbe_t    ent[3];
+	        sequence = 0;
+	event = job_giveArg(job4, proc, &digit[1]);  ASSERT_success(event);
+	event = job_giveArg(job4, proc, &digit[2]);  ASSERT_success(event);
+	event = job_giveUrgentArg(job4, proc, &digit[3]);
+	                                             ASSERT_success(event);
+	                                             ASSERT(job_count(job4) == 3);
+	event = job_take(job4);                      ASSERT_success(event);
+	event = job_take(job4);                      ASSERT_success(event);
+	event = job_take(job4);                      ASSERT_success(event);
+	                                             ASSERT(sequence == 312);
+	        sequence = 0;
+	        ent[0].fun = proc; ent[0].data.arg = &digit[4];
+	        ent[1].fun = proc; ent[1].data.arg = &digit[5];
+	        ent[2].fun = 0;    ent[2].data.job = plain;
+	event = job_giveArg(job4, proc, &digit[1]);  ASSERT_success(event);
+	event = job_giveArg(job4, proc, &digit[2]);  ASSERT_success(event);
+	event = job_giveBatch(job4, ent, 3);         ASSERT_timeout(event);
+	                                             ASSERT(job_count(job4) == 2);
+	event = job_take(job4);                      ASSERT_success(event);
+	event = job_giveBatch(job4, ent, 3);         ASSERT_success(event);
+	                                             ASSERT(job_count(job4) == 4);
+	        job_pushArg(job4, proc, &digit[3]);  ASSERT(job_count(job4) == 4);
+	event = job_take(job4);                      ASSERT_success(event);
+	event = job_take(job4);                      ASSERT_success(event);
+	event = job_take(job4);                      ASSERT_success(event);
+	event = job_take(job4);                      ASSERT_success(event);
+	event = job_take(job4);                      ASSERT_timeout(event);
+	                                             ASSERT(sequence == 14593);
+	        sequence = 0;
+		                                         ASSERT_dead(tsk1);
+	        tsk_startFrom(tsk1, proc1);          ASSERT_ready(tsk1);
+	event = job_sendArg(job4, proc, &digit[3]);  ASSERT_success(event);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+	                                             ASSERT(sequence == 3);
+}
+
+void test_job_queue_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,62 @@
+#include "test.h"
+
+static auto Job5 = JobQueueT<3>();
+
+static unsigned sequence;
+static unsigned digit[] = { 0, 1, 2, 3 };
+
+static void proc( void *arg )
+{
+	        sequence = sequence * 10 + *(unsigned *)arg;
+}
+
+static void plain()
+{
+	        sequence = sequence * 10 + 9;
+}
+
+static void proc1()
+{
+	unsigned event;
+
+	event = Job5.wait();                         ASSERT_success(event);
+	        ThisTask::stop();
+}
+
+static void test()
+{
+	unsigned event;
+	auto     job = JobQueueT<2>::create();       ASSERT(job != nullptr);
+	        sequence = 0;
+	event = job->give(plain);                    ASSERT_success(event);
+	event = job->giveArg(proc, &digit[1]);       ASSERT_success(event);
+	event = job->give(plain);                    ASSERT_timeout(event);
+	                                             ASSERT(job->count() == 2);
+	event = job->take();                         ASSERT_success(event);
+	event = job->take();                         ASSERT_success(event);
+	event = job->take();                         ASSERT_timeout(event);
+	                                             ASSERT(sequence == 91);
+	        job->destroy();
+	        sequence = 0;
+	event = Job5.giveArg(proc, &digit[2]);       ASSERT_success(event);
+	event = Job5.give(plain);                    ASSERT_success(event);
+	        Job5.pushArg(proc, &digit[3]);       ASSERT(Job5.count() == 3);
+	        Job5.push(plain);                    ASSERT(Job5.count() == 3);
+	event = Job5.take();                         ASSERT_success(event);
+	event = Job5.take();                         ASSERT_success(event);
+	event = Job5.take();                         ASSERT_success(event);
+	                                             ASSERT(sequence == 939);
+	        sequence = 0;
+	                                             ASSERT(!Tsk1);
+	        Tsk1.startFrom(proc1);               ASSERT(!!Tsk1);
+	event = Job5.sendArg(proc, &digit[3]);       ASSERT_success(event);
+	event = Tsk1.join();                         ASSERT_success(event);
+	                                             ASSERT(sequence == 3);
+}
+
+extern "C"
+void test_job_queue_5()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,32 @@
+#include "test.h"
+
+#if OS_FUNCTIONAL
+
+static auto Job6 = JobQueueT<2>();
+
+static unsigned value;
+
+static void test()
+{
+	unsigned event;
+	unsigned*ptr = &value;
+	unsigned add = 3;
+
+	        value = 1;
+	event = Job6.give([ptr, add]{ *ptr += add; }); ASSERT_success(event); // captured state travels in the delegate
+	event = Job6.give([ptr]{ *ptr *= 2; });      ASSERT_success(event);
+	                                             ASSERT(value == 1);
+	event = Job6.take();                         ASSERT_success(event);
+	                                             ASSERT(value == 4);
+	event = Job6.take();                         ASSERT_success(event);
+	                                             ASSERT(value == 8);
+}
+
+extern "C"
+void test_job_queue_6()
+{
+	TEST_Notify();
+	TEST_Call();
+}
+
+#endif
@@ -10,4 +10,8 @@ void test_mutex()
 	TEST_Add(test_mutex_4);
 	TEST_Add(test_mutex_5);
 #endif
+	TEST_Add(test_mutex_6);
+	TEST_Add(test_mutex_7);
+	TEST_Add(test_mutex_8);
+	TEST_Add(test_mutex_9);
 }
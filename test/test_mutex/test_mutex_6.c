@@ -0,0 +1,36 @@
+#include "test.h"
+
+static void proc1()
+{
+	unsigned event;
+
+	event = mtx_take(mtx1);                      ASSERT_timeout(event);
+	event = mtx_wait(mtx1);                      ASSERT_success(event);
+	event = mtx_give(mtx1);                      ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+
+	event = mtx_take(mtx1);                      ASSERT_success(event);
+	event = mtx_give(mtx1);                      ASSERT_success(event);
+	event = mtx_wait(mtx1);                      ASSERT_success(event);
+	event = mtx_take(mtx1);                      ASSERT_success(event);
+	event = mtx_give(mtx1);                      ASSERT_success(event);
+	event = mtx_give(mtx1);                      ASSERT_success(event);
+	event = mtx_give(mtx1);                      ASSERT_failure(event);
+	event = mtx_wait(mtx1);                      ASSERT_success(event);
+	                                             ASSERT_dead(tsk1);
+	        tsk_startFrom(tsk1, proc1);
+	event = mtx_give(mtx1);                      ASSERT_success(event);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+}
+
+void test_mutex_6()
+{
+	TEST_Notify();
+	mtx_init(mtx1, mtxRecursive + mtxPrioInherit + mtxRobust, 0);
+	TEST_Call();
+}
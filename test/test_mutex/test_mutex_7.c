@@ -0,0 +1,48 @@
+#include "test.h"
+
+static unsigned sent;
+
+static void proc4()
+{
+	unsigned event;
+
+	event = mtx_take(mtx1);                      ASSERT_failure(event); // task priority exceeds the mutex ceiling
+	        tsk_stop();
+}
+
+static void proc2()
+{
+	unsigned event;
+
+	event = mtx_take(mtx1);                      ASSERT_success(event); // the mutex is never found locked
+		                                         ASSERT(tsk_this()->prio == 3);
+	        sent = 2;
+	event = mtx_give(mtx1);                      ASSERT_success(event);
+		                                         ASSERT(tsk_this()->prio == 2);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+	unsigned prio = tsk_this()->prio;
+	        sent = 0;
+	event = mtx_take(mtx1);                      ASSERT_success(event);
+		                                         ASSERT(tsk_this()->prio == 3);
+		                                         ASSERT_dead(tsk2);
+	        tsk_startFrom(tsk2, proc2);          ASSERT_ready(tsk2); // preemption level below the ceiling
+		                                         ASSERT(sent == 0);
+		                                         ASSERT_dead(tsk4);
+	        tsk_startFrom(tsk4, proc4);          ASSERT_dead(tsk4);  // preemption level above the ceiling
+	event = mtx_give(mtx1);                      ASSERT_success(event);
+		                                         ASSERT(tsk_this()->prio == prio);
+		                                         ASSERT(sent == 2);
+	event = tsk_join(tsk2);                      ASSERT_success(event);
+}
+
+void test_mutex_7()
+{
+	TEST_Notify();
+	mtx_init(mtx1, mtxPrioCeiling, 3);
+	TEST_Call();
+}
@@ -0,0 +1,64 @@
+#include "test.h"
+
+static_MTX(mtx3, mtxPrioInherit);
+
+static void proc3()
+{
+	unsigned event;
+
+	event = mtx_wait(mtx1);                      ASSERT_success(event);
+	event = mtx_give(mtx1);                      ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void proc2()
+{
+	unsigned event;
+
+	event = mtx_wait(mtx3);                      ASSERT_success(event);
+	event = mtx_give(mtx3);                      ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void proc1()
+{
+	unsigned event;
+
+	event = mtx_wait(mtx2);                      ASSERT_success(event);
+	event = mtx_give(mtx2);                      ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+	unsigned prio = tsk_this()->prio;
+
+	event = mtx_wait(mtx1);                      ASSERT_success(event);
+	event = mtx_wait(mtx2);                      ASSERT_success(event);
+	event = mtx_wait(mtx3);                      ASSERT_success(event);
+		                                         ASSERT_dead(tsk1);
+	        tsk_startFrom(tsk1, proc1);          ASSERT(tsk_this()->prio == 1);
+		                                         ASSERT_dead(tsk2);
+	        tsk_startFrom(tsk2, proc2);          ASSERT(tsk_this()->prio == 2);
+		                                         ASSERT_dead(tsk3);
+	        tsk_startFrom(tsk3, proc3);          ASSERT(tsk_this()->prio == 3);
+	event = mtx_give(mtx2);                      ASSERT_success(event); // released out of order
+		                                         ASSERT(tsk_this()->prio == 3);
+	event = mtx_give(mtx1);                      ASSERT_success(event);
+		                                         ASSERT_dead(tsk3);
+		                                         ASSERT(tsk_this()->prio == 2);
+	event = mtx_give(mtx3);                      ASSERT_success(event);
+		                                         ASSERT(tsk_this()->prio == prio);
+	event = tsk_join(tsk3);                      ASSERT_success(event);
+	event = tsk_join(tsk2);                      ASSERT_success(event);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+}
+
+void test_mutex_8()
+{
+	TEST_Notify();
+	mtx_init(mtx1, mtxPrioInherit, 0);
+	mtx_init(mtx2, mtxPrioInherit, 0);
+	TEST_Call();
+}
@@ -0,0 +1,43 @@
+#include "test.h"
+
+static void proc1()
+{
+	unsigned event;
+
+	event = mtx_wait(mtx1);                      ASSERT_success(event);
+		                                         ASSERT(mtx1->owner == tsk1);
+	event = mtx_give(mtx1);                      ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void proc3()
+{
+	unsigned event;
+
+	event = mtx_wait(mtx1);                      ASSERT_success(event);
+		                                         ASSERT_dead(tsk1);
+	        tsk_startFrom(tsk1, proc1);
+	        tsk_delay(2);                        ASSERT(tsk1->guard == &mtx1->obj.queue); // tsk1 is waiting for the mutex
+	event = mtx_give(mtx1);                      ASSERT_success(event);
+		                                         ASSERT(tsk1->guard == 0);                // tsk1 has been resumed ...
+		                                         ASSERT(mtx1->owner == 0);                // ... but it doesn't own the mutex
+	event = mtx_take(mtx1);                      ASSERT_success(event);                   // lock the mutex again without a context switch
+	event = mtx_give(mtx1);                      ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+		                                         ASSERT_dead(tsk3);
+	        tsk_startFrom(tsk3, proc3);
+	event = tsk_join(tsk3);                      ASSERT_success(event);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+}
+
+void test_mutex_9()
+{
+	TEST_Notify();
+	mtx_init(mtx1, mtxBarging, 0);
+	TEST_Call();
+}
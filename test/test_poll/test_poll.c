@@ -0,0 +1,12 @@
+#include "test.h"
+
+void test_poll()
+{
+	UNIT_Notify();
+	TEST_Add(test_poll_1);
+	TEST_Add(test_poll_4);
+#ifndef __CSMC__
+	TEST_Add(test_poll_2);
+	TEST_Add(test_poll_3);
+#endif
+}
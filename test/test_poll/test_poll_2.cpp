@@ -0,0 +1,50 @@
+#include "test.h"
+
+#define FLAG 1U
+
+static_SEM(sem3, 0, semBinary);
+static_FLG(flg3, 0);
+static_EVQ(evq3, 1);
+static_TMR(tmr3, NULL);
+
+static void proc1()
+{
+	unsigned event;
+	unsigned value;
+	pol_t    list[] = { POL_SEM(sem3), POL_FLG(flg3, FLAG), POL_EVQ(evq3), POL_TMR(tmr3) };
+
+	event = sys_waitAny(list, 4, INFINITE);      ASSERT(event == 0);
+	event = sem_take(sem3);                      ASSERT_success(event);
+	event = sys_waitAny(list, 4, INFINITE);      ASSERT(event == 1);
+	event = flg_take(flg3, FLAG, flgAll);        ASSERT_success(event);
+	event = sys_waitAny(list, 4, INFINITE);      ASSERT(event == 2);
+	event = evq_take(evq3, &value);              ASSERT_success(event);
+	                                             ASSERT(value == 3);
+	event = sys_waitAny(list, 4, INFINITE);      ASSERT(event == 3);
+	event = tmr_take(tmr3);                      ASSERT_success(event);
+	event = sys_waitAny(list, 3, IMMEDIATE);     ASSERT_timeout(event);
+	event = sys_waitAnyUntil(list, 4, sys_time()); ASSERT_timeout(event); // time point has already passed
+	                                             ASSERT(sem3->obj.pol == 0); // no poller left linked
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+	                                             ASSERT_dead(tsk1);
+	        tsk_startFrom(tsk1, proc1);          ASSERT_ready(tsk1);
+	event = sem_give(sem3);                      ASSERT_success(event);
+	        flg_give(flg3, FLAG);
+	event = evq_give(evq3, 3);                   ASSERT_success(event);
+	        tmr_startFor(tmr3, 1);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+	event = sem_give(sem3);                      ASSERT_success(event);
+	event = sem_take(sem3);                      ASSERT_success(event);
+}
+
+extern "C"
+void test_poll_2()
+{
+	TEST_Notify();
+	TEST_Call();
+}
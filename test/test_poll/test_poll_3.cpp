@@ -0,0 +1,50 @@
+#include "test.h"
+
+#define FLAG 1U
+
+static auto Sem3 = Semaphore(0, semBinary);
+static auto Flg3 = Flag();
+static auto Evq3 = EventQueueT<1>();
+static auto Tmr3 = Timer(nullptr);
+
+static void proc1()
+{
+	unsigned event;
+	unsigned value;
+	pol_t    list[] = { POL_SEM(&Sem3), POL_FLG(&Flg3, FLAG), POL_EVQ(&Evq3), POL_TMR(&Tmr3) };
+
+	event = sys_waitAny(list, 4, INFINITE);      ASSERT(event == 0);
+	event = Sem3.take();                         ASSERT_success(event);
+	event = sys_waitAny(list, 4, INFINITE);      ASSERT(event == 1);
+	event = Flg3.take(FLAG, flgAll);             ASSERT_success(event);
+	event = sys_waitAny(list, 4, INFINITE);      ASSERT(event == 2);
+	event = Evq3.take(&value);                   ASSERT_success(event);
+	                                             ASSERT(value == 3);
+	event = sys_waitAny(list, 4, INFINITE);      ASSERT(event == 3);
+	event = Tmr3.take();                         ASSERT_success(event);
+	event = sys_waitAny(list, 3, IMMEDIATE);     ASSERT_timeout(event);
+	event = sys_waitAnyUntil(list, 4, sys_time()); ASSERT_timeout(event); // time point has already passed
+	                                             ASSERT(Sem3.obj.pol == nullptr); // no poller left linked
+	        ThisTask::stop();
+}
+
+static void test()
+{
+	unsigned event;
+	                                             ASSERT(!Tsk1);
+	        Tsk1.startFrom(proc1);               ASSERT(!!Tsk1);
+	event = Sem3.give();                         ASSERT_success(event);
+	        Flg3.give(FLAG);
+	event = Evq3.give(3);                        ASSERT_success(event);
+	        Tmr3.startFor(1);
+	event = Tsk1.join();                         ASSERT_success(event);
+	event = Sem3.give();                         ASSERT_success(event);
+	event = Sem3.take();                         ASSERT_success(event);
+}
+
+extern "C"
+void test_poll_3()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,48 @@
+#include "test.h"
+
+static_MTX(mtx4, mtxPrioInherit);
+static_SEM(sem4, 0, semBinary);
+
+static void proc1()
+{
+	unsigned event;
+	pol_t    list[] = { POL_SEM(sem4) };
+
+	event = mtx_lock(mtx4);                      ASSERT_success(event);
+	event = sys_waitAny(list, 1, INFINITE);      ASSERT(event == 0);
+	                                             ASSERT(tsk_this()->prio == 2);
+	event = sem_take(sem4);                      ASSERT_success(event);
+	event = mtx_unlock(mtx4);                    ASSERT_success(event);
+	                                             ASSERT(tsk_this()->prio == 1);
+	        tsk_stop();
+}
+
+static void proc2()
+{
+	unsigned event;
+
+	event = mtx_lock(mtx4);                      ASSERT_success(event);
+	event = mtx_unlock(mtx4);                    ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+	                                             ASSERT_dead(tsk1);
+	        tsk_startFrom(tsk1, proc1);          ASSERT_ready(tsk1);
+	                                             ASSERT(sem4->obj.pol != 0);
+	                                             ASSERT_dead(tsk2);
+	        tsk_startFrom(tsk2, proc2);          ASSERT_ready(tsk2);
+	                                             ASSERT(tsk1->prio == 2); // the polling task inherits the priority
+	                                             ASSERT(sem4->obj.pol != 0); // and is still polling the semaphore
+	event = sem_give(sem4);                      ASSERT_success(event);
+	event = tsk_join(tsk2);                      ASSERT_success(event);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+}
+
+void test_poll_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
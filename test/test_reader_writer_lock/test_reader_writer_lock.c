@@ -0,0 +1,13 @@
+#include "test.h"
+
+void test_reader_writer_lock()
+{
+	UNIT_Notify();
+	TEST_Add(test_reader_writer_lock_1);
+#ifndef __CSMC__
+	TEST_Add(test_reader_writer_lock_2);
+	TEST_Add(test_reader_writer_lock_3);
+#endif
+	TEST_Add(test_reader_writer_lock_4);
+	TEST_Add(test_reader_writer_lock_5);
+}
@@ -0,0 +1,60 @@
+#include "test.h"
+
+static_RWL(rwl3, rwlWriterPref + rwlPrioInherit);
+
+static void proc3()
+{
+	unsigned event;
+
+	event = rwl_takeWrite(rwl3);                 ASSERT_timeout(event);
+	event = rwl_waitWrite(rwl3);                 ASSERT_success(event);
+	event = rwl_takeWrite(rwl3);                 ASSERT_failure(event);
+	event = rwl_takeRead(rwl3);                  ASSERT_timeout(event);
+	event = rwl_giveWrite(rwl3);                 ASSERT_success(event);
+	event = rwl_giveWrite(rwl3);                 ASSERT_failure(event);
+	        tsk_stop();
+}
+
+static void proc2()
+{
+	unsigned event;
+
+	event = rwl_takeRead(rwl3);                  ASSERT_timeout(event);
+	event = rwl_waitRead(rwl3);                  ASSERT_success(event);
+	event = rwl_giveRead(rwl3);                  ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void proc1()
+{
+	unsigned event;
+
+	event = rwl_waitRead(rwl3);                  ASSERT_success(event);
+	                                             ASSERT_dead(tsk3);
+	        tsk_startFrom(tsk3, proc3);          ASSERT_ready(tsk3);
+	                                             ASSERT_dead(tsk2);
+	        tsk_startFrom(tsk2, proc2);          ASSERT_ready(tsk2);
+	event = rwl_giveRead(rwl3);                  ASSERT_success(event);
+	event = tsk_join(tsk2);                      ASSERT_success(event);
+	event = tsk_join(tsk3);                      ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+
+	event = rwl_takeRead(rwl3);                  ASSERT_success(event);
+	event = rwl_takeWrite(rwl3);                 ASSERT_timeout(event);
+	event = rwl_giveRead(rwl3);                  ASSERT_success(event);
+	event = rwl_giveRead(rwl3);                  ASSERT_failure(event);
+	                                             ASSERT_dead(tsk1);
+	        tsk_startFrom(tsk1, proc1);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+}
+
+void test_reader_writer_lock_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,43 @@
+#include "test.h"
+#include <mutex>
+#include <shared_mutex>
+
+static auto Rwl3 = ReaderWriterLock(rwlWriterPref);
+
+static void proc2()
+{
+	        std::unique_lock<ReaderWriterLock> lock(Rwl3);
+	                                             ASSERT(lock.owns_lock());
+	                                             ASSERT(!Rwl3.try_lock_shared());
+	        lock.unlock();
+	        ThisTask::stop();
+}
+
+static void proc1()
+{
+	        std::shared_lock<ReaderWriterLock> lock(Rwl3);
+	                                             ASSERT(lock.owns_lock());
+	                                             ASSERT(!Tsk2);
+	        Tsk2.startFrom(proc2);               ASSERT(!!Tsk2);
+	                                             ASSERT(!Rwl3.try_lock_shared());
+	        lock.unlock();
+	        ThisTask::stop();
+}
+
+static void test()
+{
+	unsigned event;
+	                                             ASSERT(!Tsk1);
+	        Tsk1.startFrom(proc1);               ASSERT(!!Tsk1);
+	event = Tsk2.join();                         ASSERT_success(event);
+	event = Tsk1.join();                         ASSERT_success(event);
+	                                             ASSERT(Rwl3.try_lock());
+	        Rwl3.unlock();
+}
+
+extern "C"
+void test_reader_writer_lock_3()
+{
+	TEST_Notify();
+	TEST_Call();
+}
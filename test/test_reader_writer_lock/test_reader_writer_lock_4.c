@@ -0,0 +1,35 @@
+#include "test.h"
+
+static_RWL(rwl3, rwlDefault);
+
+static void proc()
+{
+	unsigned event;
+
+	event = rwl_takeRead(rwl3);                  ASSERT_success(event);
+	event = rwl_giveRead(rwl3);                  ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+
+	event = rwl_waitRead(rwl3);                  ASSERT_success(event);
+	                                             ASSERT_dead(tsk1);
+	        tsk_startFrom(tsk1, proc);           ASSERT_dead(tsk1);
+	                                             ASSERT_dead(tsk2);
+	        tsk_startFrom(tsk2, proc);           ASSERT_dead(tsk2);
+	                                             ASSERT_dead(tsk3);
+	        tsk_startFrom(tsk3, proc);           ASSERT_dead(tsk3);
+	event = rwl_giveRead(rwl3);                  ASSERT_success(event);
+	event = tsk_join(tsk3);                      ASSERT_success(event);
+	event = tsk_join(tsk2);                      ASSERT_success(event);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+}
+
+void test_reader_writer_lock_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
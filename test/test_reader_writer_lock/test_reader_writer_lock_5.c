@@ -0,0 +1,44 @@
+#include "test.h"
+
+static_RWL(rwl3, rwlPrioInherit);
+
+static void proc3()
+{
+	unsigned event;
+
+	event = rwl_waitWrite(rwl3);                 ASSERT_success(event);
+	event = rwl_giveWrite(rwl3);                 ASSERT_success(event);
+	        tsk_stop();
+}
+
+static void proc1()
+{
+	unsigned event;
+
+	event = rwl_takeWrite(rwl3);                 ASSERT_success(event);
+	event = mtx_take(mtx1);                      ASSERT_success(event);
+	                                             ASSERT_dead(tsk3);
+	        tsk_startFrom(tsk3, proc3);          ASSERT_ready(tsk3);
+	                                             ASSERT(tsk_this()->prio == 3);
+	event = mtx_give(mtx1);                      ASSERT_success(event); // unrelated mutex
+	                                             ASSERT(tsk_this()->prio == 3); // the writer is still waiting
+	event = rwl_giveWrite(rwl3);                 ASSERT_success(event);
+	                                             ASSERT_dead(tsk3);
+	                                             ASSERT(tsk_this()->prio == 1);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+	                                             ASSERT_dead(tsk1);
+	        tsk_startFrom(tsk1, proc1);          ASSERT_dead(tsk1);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+	event = tsk_join(tsk3);                      ASSERT_success(event);
+}
+
+void test_reader_writer_lock_5()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,12 @@
+#include "test.h"
+
+void test_rpc()
+{
+	UNIT_Notify();
+	TEST_Add(test_rpc_1);
+	TEST_Add(test_rpc_4);
+#ifndef __CSMC__
+	TEST_Add(test_rpc_2);
+	TEST_Add(test_rpc_3);
+#endif
+}
@@ -0,0 +1,55 @@
+#include "test.h"
+
+static_RPC(rpc);
+
+static void server()
+{
+	unsigned event;
+	unsigned data;
+
+	event = rpc_wait(rpc, &data);                ASSERT_success(event); // request from the queued client
+	                                             ASSERT(tsk_this()->prio == data);
+	event = rpc_reply(rpc, data + 1);            ASSERT_success(event);
+	                                             ASSERT(tsk_this()->prio == 1);
+	event = rpc_wait(rpc, &data);                ASSERT_success(event); // request handed over directly
+	                                             ASSERT(tsk_this()->prio == data);
+	event = rpc_reply(rpc, data + 1);            ASSERT_success(event);
+	                                             ASSERT(tsk_this()->prio == 1);
+	event = rpc_wait(rpc, &data);                ASSERT_stopped(event);
+	        tsk_stop();
+}
+
+static void client()
+{
+	unsigned event;
+	unsigned data = tsk_this()->prio;
+
+	event = rpc_call(rpc, &data);                ASSERT_success(event);
+	                                             ASSERT(data == tsk_this()->prio + 1);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+	unsigned data = 0;
+	                                             ASSERT_dead(tsk2);
+	        tsk_startFrom(tsk2, client);         ASSERT_ready(tsk2); // no server yet
+	                                             ASSERT_dead(tsk1);
+	        tsk_startFrom(tsk1, server);         ASSERT_ready(tsk1);
+	                                             ASSERT_dead(tsk2);
+	                                             ASSERT_dead(tsk3);
+	        tsk_startFrom(tsk3, client);         ASSERT_dead(tsk3);  // served at once
+	event = tsk_join(tsk3);                      ASSERT_success(event);
+	event = tsk_join(tsk2);                      ASSERT_success(event);
+	event = rpc_callFor(rpc, &data, IMMEDIATE);  ASSERT_timeout(event);
+	event = rpc_reply(rpc, data);                ASSERT_failure(event);
+	        rpc_reset(rpc);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+}
+
+void test_rpc_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
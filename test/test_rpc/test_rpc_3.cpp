@@ -0,0 +1,56 @@
+#include "test.h"
+
+static RemoteCall Rpc;
+
+static void server()
+{
+	unsigned event;
+	unsigned data;
+
+	event = Rpc.wait(&data);                     ASSERT_success(event); // request from the queued client
+	                                             ASSERT(tsk_this()->prio == data);
+	event = Rpc.reply(data + 1);                 ASSERT_success(event);
+	                                             ASSERT(tsk_this()->prio == 1);
+	event = Rpc.wait(&data);                     ASSERT_success(event); // request handed over directly
+	                                             ASSERT(tsk_this()->prio == data);
+	event = Rpc.reply(data + 1);                 ASSERT_success(event);
+	                                             ASSERT(tsk_this()->prio == 1);
+	event = Rpc.wait(&data);                     ASSERT_stopped(event);
+	        ThisTask::stop();
+}
+
+static void client()
+{
+	unsigned event;
+	unsigned data = tsk_this()->prio;
+
+	event = Rpc.call(&data);                     ASSERT_success(event);
+	                                             ASSERT(data == tsk_this()->prio + 1);
+	        ThisTask::stop();
+}
+
+static void test()
+{
+	unsigned event;
+	unsigned data = 0;
+	                                             ASSERT(!Tsk2);
+	        Tsk2.startFrom(client);              ASSERT(!!Tsk2); // no server yet
+	                                             ASSERT(!Tsk1);
+	        Tsk1.startFrom(server);              ASSERT(!!Tsk1);
+	                                             ASSERT(!Tsk2);
+	                                             ASSERT(!Tsk3);
+	        Tsk3.startFrom(client);              ASSERT(!Tsk3);  // served at once
+	event = Tsk3.join();                         ASSERT_success(event);
+	event = Tsk2.join();                         ASSERT_success(event);
+	event = Rpc.callFor(&data, IMMEDIATE);       ASSERT_timeout(event);
+	event = Rpc.reply(data);                     ASSERT_failure(event);
+	        Rpc.reset();
+	event = Tsk1.join();                         ASSERT_success(event);
+}
+
+extern "C"
+void test_rpc_3()
+{
+	TEST_Notify();
+	TEST_Call();
+}
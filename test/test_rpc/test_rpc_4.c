@@ -0,0 +1,49 @@
+#include "test.h"
+
+static_RPC(rpc4);
+
+static void server()
+{
+	unsigned event;
+	unsigned data;
+
+	event = rpc_wait(rpc4, &data);               ASSERT_success(event);
+	                                             ASSERT(tsk_this()->prio == 3);
+	event = mtx_lock(mtx1);                      ASSERT_success(event);
+	event = mtx_unlock(mtx1);                    ASSERT_success(event);
+	                                             ASSERT(tsk_this()->prio == 3); // the priority lent by the client is kept
+	event = rpc_reply(rpc4, data + 1);           ASSERT_success(event);
+	                                             ASSERT(tsk_this()->prio == 1);
+	        tsk_stop();
+}
+
+static void client()
+{
+	unsigned event;
+	unsigned data = 0;
+
+	event = rpc_call(rpc4, &data);               ASSERT_success(event);
+	                                             ASSERT(data == 1);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+	event = mtx_lock(mtx1);                      ASSERT_success(event);
+	                                             ASSERT_dead(tsk1);
+	        tsk_startFrom(tsk1, server);         ASSERT_ready(tsk1);
+	                                             ASSERT_dead(tsk3);
+	        tsk_startFrom(tsk3, client);         ASSERT_ready(tsk3); // the server is blocked on the mutex
+	event = rpc_reply(rpc4, 0);                  ASSERT_failure(event); // only the server can reply
+	event = mtx_unlock(mtx1);                    ASSERT_success(event);
+	                                             ASSERT_dead(tsk3);
+	event = tsk_join(tsk3);                      ASSERT_success(event);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+}
+
+void test_rpc_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
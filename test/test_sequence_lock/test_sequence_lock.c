@@ -0,0 +1,13 @@
+#include "test.h"
+
+void test_sequence_lock()
+{
+	UNIT_Notify();
+	TEST_Add(test_sequence_lock_1);
+#ifndef __CSMC__
+	TEST_Add(test_sequence_lock_2);
+	TEST_Add(test_sequence_lock_3);
+#endif
+	TEST_Add(test_sequence_lock_4);
+	TEST_Add(test_sequence_lock_5);
+}
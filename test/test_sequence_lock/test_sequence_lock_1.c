@@ -0,0 +1,36 @@
+#include "test.h"
+
+typedef struct { unsigned lo, hi; } pair_t;
+
+static_SEQ(seq3);
+static pair_t pair3;
+
+static void proc()
+{
+	seq_writeBeginISR(seq3);
+	pair3.lo++;
+	pair3.hi--;
+	seq_writeEndISR(seq3);
+}
+
+static void test()
+{
+	unsigned event;
+	unsigned cnt;
+	pair_t   data;
+
+	        tmr_startFrom(tmr1, 1, 1, proc);
+	event = tmr_wait(tmr1);                      ASSERT_success(event);
+	cnt   = seq_readBegin(seq3);                 ASSERT((cnt & 1U) == 0);
+	        seq_read(seq3, &data, &pair3, sizeof(data));
+	                                             ASSERT(data.lo + data.hi == 0);
+	event = tmr_wait(tmr1);                      ASSERT_success(event);
+	                                             ASSERT(seq_readRetry(seq3, cnt));
+	        tmr_stop(tmr1);
+}
+
+void test_sequence_lock_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
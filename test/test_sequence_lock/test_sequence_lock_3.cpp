@@ -0,0 +1,26 @@
+#include "test.h"
+
+struct Pair { unsigned lo, hi; };
+
+static auto Pair3 = SeqLocked<Pair>({ 0, 0 });
+static auto Tmr3  = Timer([]{ Pair p = Pair3; p.lo++; p.hi--; Pair3 = p; });
+
+static void test()
+{
+	unsigned event;
+	Pair     data;
+
+	        Tmr3.startPeriodic(1);
+	event = Tmr3.wait();                         ASSERT_success(event);
+	data  = Pair3.load();                        ASSERT(data.lo + data.hi == 0);
+	event = Tmr3.wait();                         ASSERT_success(event);
+	data  = Pair3;                               ASSERT(data.lo + data.hi == 0);
+	        Tmr3.stop();
+}
+
+extern "C"
+void test_sequence_lock_3()
+{
+	TEST_Notify();
+	TEST_Call();
+}
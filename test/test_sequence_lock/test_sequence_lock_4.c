@@ -0,0 +1,25 @@
+#include "test.h"
+
+typedef struct { unsigned lo, hi; } pair_t;
+
+static_SEQ(seq3);
+static pair_t pair3;
+
+static void test()
+{
+	pair_t   data;
+	unsigned i;
+
+	        seq_write(seq3, &pair3, &(pair_t){ 1, 0U-1 }, sizeof(pair3));
+	for (i = 0; i < 16; i++)
+	{
+	        seq_read(seq3, &data, &pair3, sizeof(data));
+	                                             ASSERT(data.lo + data.hi == 0);
+	}
+}
+
+void test_sequence_lock_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,28 @@
+#include "test.h"
+
+typedef struct { unsigned lo, hi; } pair_t;
+
+static pair_t pair3;
+
+static void test()
+{
+	pair_t   data;
+	unsigned i;
+
+	        sys_lock();
+	        pair3 = (pair_t){ 1, 0U-1 };
+	        sys_unlock();
+	for (i = 0; i < 16; i++)
+	{
+	        sys_lock();
+	        data = pair3;
+	        sys_unlock();
+	                                             ASSERT(data.lo + data.hi == 0);
+	}
+}
+
+void test_sequence_lock_5()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -9,12 +9,26 @@ void test_task()
 	TEST_Add(test_task_create_3);
 	TEST_Add(test_task_infinite_loop_1);
 	TEST_Add(test_task_signal_1);
+	TEST_Add(test_task_sleep_1);
+	TEST_Add(test_task_period_1);
+	TEST_Add(test_task_basic_1);
 #ifndef __CSMC__
 	TEST_Add(test_task_infinite_loop_2);
 	TEST_Add(test_task_infinite_loop_3);
 	TEST_Add(test_task_signal_2);
 	TEST_Add(test_task_signal_3);
+	TEST_Add(test_task_sleep_2);
+	TEST_Add(test_task_sleep_3);
+	TEST_Add(test_task_period_2);
+	TEST_Add(test_task_period_3);
 	TEST_Add(test_task_create_4);
 	TEST_Add(test_task_create_5);
+	TEST_Add(test_task_basic_3);
+#if OS_FUNCTIONAL
+	TEST_Add(test_task_lambda_1);
+#endif
+#endif
+#if OS_EDF_PRIO
+	TEST_Add(test_task_edf_1);
 #endif
 }
@@ -0,0 +1,49 @@
+#include "test.h"
+
+static_STK(stk, OS_STACK_SIZE);
+
+static void proc1();
+static void proc2();
+
+static_BSK(bsk1, 1, proc1, stk);
+static_BSK(bsk2, 1, proc2, stk);
+
+static unsigned sequence;
+static unsigned runs;
+
+static void proc1()
+{
+	unsigned event;
+
+	        sequence = sequence * 10 + 1;
+	if (runs++ == 0)
+	{
+	event = tsk_activate(bsk2);                  ASSERT_success(event);
+		                                         ASSERT_ready(bsk2);
+	event = tsk_activate(bsk1);                  ASSERT_success(event); // run again after bsk2
+	}
+}
+
+static void proc2()
+{
+	        sequence = sequence * 10 + 2;
+}
+
+static void test()
+{
+	unsigned event;
+	        sequence = 0;
+	        runs = 0;
+		                                         ASSERT_dead(bsk1);
+		                                         ASSERT_dead(bsk2);
+	event = tsk_activate(bsk1);                  ASSERT_success(event);
+		                                         ASSERT(sequence == 121);
+		                                         ASSERT_dead(bsk1);
+		                                         ASSERT_dead(bsk2);
+}
+
+void test_task_basic_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,45 @@
+#include "test.h"
+
+static SharedStack Stk;
+
+static unsigned sequence;
+static unsigned runs;
+
+extern BasicTask Bsk2;
+
+static BasicTask Bsk1(1, []
+{
+	unsigned event;
+
+	        sequence = sequence * 10 + 1;
+	if (runs++ == 0)
+	{
+	event = Bsk2.activate();                     ASSERT_success(event);
+	event = Bsk1.activate();                     ASSERT_success(event); // run again after Bsk2
+	}
+}, Stk);
+
+BasicTask Bsk2(1, []
+{
+	        sequence = sequence * 10 + 2;
+}, Stk);
+
+static void test()
+{
+	unsigned event;
+	        sequence = 0;
+	        runs = 0;
+		                                         ASSERT(!Bsk1);
+		                                         ASSERT(!Bsk2);
+	event = Bsk1.activate();                     ASSERT_success(event);
+		                                         ASSERT(sequence == 121);
+		                                         ASSERT(!Bsk1);
+		                                         ASSERT(!Bsk2);
+}
+
+extern "C"
+void test_task_basic_3()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,44 @@
+#include "test.h"
+
+#if OS_EDF_PRIO
+
+static tsk_t   *order[2];
+static unsigned count;
+
+static void proc()
+{
+	unsigned received;
+	unsigned event;
+	unsigned prio = tsk_getPrio();
+
+	        tsk_setDeadline(sys_time() + (tsk_this() == tsk3 ? 10 : 20));
+	        tsk_setPrio(OS_EDF_PRIO);
+	event = evt_wait(evt2, &received);           ASSERT_success(event);
+	        order[count++] = tsk_this();
+	        tsk_setPrio(prio);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+	        count = 0;
+		                                         ASSERT_dead(tsk4);
+	        tsk_startFrom(tsk4, proc);           ASSERT_ready(tsk4);
+		                                         ASSERT_dead(tsk3);
+	        tsk_startFrom(tsk3, proc);           ASSERT_ready(tsk3);
+	        evt_give(evt2, 0);
+	event = tsk_join(tsk4);                      ASSERT_success(event);
+	event = tsk_join(tsk3);                      ASSERT_success(event);
+		                                         ASSERT(count == 2);
+		                                         ASSERT(order[0] == tsk3); // the earliest deadline first
+		                                         ASSERT(order[1] == tsk4);
+}
+
+void test_task_edf_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
+
+#endif
@@ -0,0 +1,27 @@
+#include "test.h"
+
+#if OS_FUNCTIONAL
+
+static unsigned value;
+
+static void test()
+{
+	unsigned event;
+	unsigned*ptr = &value;
+	unsigned add = 3;
+
+	        value = 1;
+	                                             ASSERT(!Tsk1);
+	        Tsk1.startFrom([ptr, add]{ *ptr += add; ThisTask::stop(); }); // captured state travels in the delegate
+	event = Tsk1.join();                         ASSERT_success(event);
+	                                             ASSERT(value == 4);
+}
+
+extern "C"
+void test_task_lambda_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
+
+#endif
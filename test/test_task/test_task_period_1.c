@@ -0,0 +1,47 @@
+#include "test.h"
+
+static prd_t    prd;
+static unsigned overruns = 0;
+
+static void hook()
+{
+	        overruns++;
+}
+
+static void proc()
+{
+	unsigned event;
+	unsigned i;
+
+	        tsk_setPeriod(&prd, 5, hook);
+	for (i = 0; i < 3; i++)
+	{
+	event = tsk_waitNextPeriod();                ASSERT_success(event);
+	}
+	        tsk_delay(12);
+	event = tsk_waitNextPeriod();                ASSERT_timeout(event);
+	event = tsk_waitNextPeriod();                ASSERT_success(event);
+	        tsk_setPeriod(0, 0, 0);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+		                                         ASSERT_dead(tsk1);
+	        overruns = 0;
+	        tsk_startFrom(tsk1, proc);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+		                                         ASSERT(overruns == 1);
+		                                         ASSERT(prd.miss == 1);
+		                                         ASSERT(prd.count == 5);
+		                                         ASSERT(prd.rsp.max >= 12);
+		                                         ASSERT(prd.rsp.min <= prd.rsp.max);
+		                                         ASSERT(prd.rsp.sum >= prd.rsp.max);
+}
+
+void test_task_period_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
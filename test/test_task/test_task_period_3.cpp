@@ -0,0 +1,48 @@
+#include "test.h"
+
+static prd_t    prd;
+static unsigned overruns = 0;
+
+static void hook()
+{
+	        overruns++;
+}
+
+static void proc()
+{
+	unsigned event;
+	unsigned i;
+
+	        ThisTask::setPeriod(&prd, 5, hook);
+	for (i = 0; i < 3; i++)
+	{
+	event = ThisTask::waitNextPeriod();          ASSERT_success(event);
+	}
+	        ThisTask::delay(12);
+	event = ThisTask::waitNextPeriod();          ASSERT_timeout(event);
+	event = ThisTask::waitNextPeriod();          ASSERT_success(event);
+	        ThisTask::setPeriod(nullptr, 0);
+	        ThisTask::stop();
+}
+
+static void test()
+{
+	unsigned event;
+		                                         ASSERT(!Tsk1);
+	        overruns = 0;
+	        Tsk1.startFrom(proc);
+	event = Tsk1.join();                         ASSERT_success(event);
+		                                         ASSERT(overruns == 1);
+		                                         ASSERT(prd.miss == 1);
+		                                         ASSERT(prd.count == 5);
+		                                         ASSERT(prd.rsp.max >= 12);
+		                                         ASSERT(prd.rsp.min <= prd.rsp.max);
+		                                         ASSERT(prd.rsp.sum >= prd.rsp.max);
+}
+
+extern "C"
+void test_task_period_3()
+{
+	TEST_Notify();
+	TEST_Call();
+}
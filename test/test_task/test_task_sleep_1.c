@@ -0,0 +1,32 @@
+#include "test.h"
+
+static void proc()
+{
+	uint32_t start;
+	uint32_t time;
+
+	start = sys_hrtime();
+	        tsk_sleepForUs(200);
+	time  = sys_hrtime() - start;                ASSERT(time >= 200);
+	start = sys_hrtime();
+	        tsk_sleepForUs(2500);
+	time  = sys_hrtime() - start;                ASSERT(time >= 2500);
+	        tsk_stop();
+}
+
+static void test()
+{
+	unsigned event;
+	uint32_t time;
+		                                         ASSERT_dead(tsk1);
+	time  = sys_hrtime();
+	        tsk_startFrom(tsk1, proc);
+	event = tsk_join(tsk1);                      ASSERT_success(event);
+	time  = sys_hrtime() - time;                 ASSERT(time >= 200 + 2500);
+}
+
+void test_task_sleep_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,33 @@
+#include "test.h"
+
+static void proc()
+{
+	uint32_t start;
+	uint32_t time;
+
+	start = sys_hrtime();
+	        ThisTask::sleepForUs(200);
+	time  = sys_hrtime() - start;                ASSERT(time >= 200);
+	start = sys_hrtime();
+	        ThisTask::sleepForUs(2500);
+	time  = sys_hrtime() - start;                ASSERT(time >= 2500);
+	        ThisTask::stop();
+}
+
+static void test()
+{
+	unsigned event;
+	uint32_t time;
+		                                         ASSERT(!Tsk1);
+	time  = sys_hrtime();
+	        Tsk1.startFrom(proc);
+	event = Tsk1.join();                         ASSERT_success(event);
+	time  = sys_hrtime() - time;                 ASSERT(time >= 200 + 2500);
+}
+
+extern "C"
+void test_task_sleep_3()
+{
+	TEST_Notify();
+	TEST_Call();
+}
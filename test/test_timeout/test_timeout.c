@@ -0,0 +1,11 @@
+#include "test.h"
+
+void test_timeout()
+{
+	UNIT_Notify();
+	TEST_Add(test_timeout_1);
+#ifndef __CSMC__
+	TEST_Add(test_timeout_2);
+	TEST_Add(test_timeout_3);
+#endif
+}
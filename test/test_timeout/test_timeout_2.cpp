@@ -0,0 +1,35 @@
+#include "test.h"
+
+static unsigned counter;
+
+static void proc( void *arg )
+{
+	        (*(unsigned *)arg)++;
+}
+
+static_TMO(tmo1, proc, &counter);
+static_TMO(tmo2, proc, &counter);
+static_TMO(tmo3, proc, &counter);
+
+static void test()
+{
+	unsigned event;
+
+	        counter = 0;
+	        tmo_start(tmo1, 3);
+	        tmo_start(tmo2, 1);
+	        tmo_start(tmo3, 2);
+	event = tmo_stop(tmo3);                      ASSERT_success(event);
+	event = tmo_stop(tmo3);                      ASSERT_failure(event);
+	        tsk_delay(4);
+	                                             ASSERT(counter == 2);
+	                                             ASSERT(!tmo_active(tmo1));
+	                                             ASSERT(!tmo_active(tmo2));
+}
+
+extern "C"
+void test_timeout_2()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,35 @@
+#include "test.h"
+
+static unsigned counter;
+
+static void proc( void *arg )
+{
+	        (*static_cast<unsigned *>(arg))++;
+}
+
+static auto Tmo1 = Timeout(proc, &counter);
+static auto Tmo2 = Timeout(proc, &counter);
+static auto Tmo3 = Timeout(proc, &counter);
+
+static void test()
+{
+	unsigned event;
+
+	        counter = 0;
+	        Tmo1.start(3);
+	        Tmo2.start(1);
+	        Tmo3.start(2);
+	event = Tmo3.stop();                         ASSERT_success(event);
+	event = Tmo3.stop();                         ASSERT_failure(event);
+	        ThisTask::delay(4);
+	                                             ASSERT(counter == 2);
+	                                             ASSERT(!Tmo1);
+	                                             ASSERT(!Tmo2);
+}
+
+extern "C"
+void test_timeout_3()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -7,5 +7,12 @@ void test_timer()
 #ifndef __CSMC__
 	TEST_Add(test_timer_2);
 	TEST_Add(test_timer_3);
+#if OS_FUNCTIONAL
+	TEST_Add(test_timer_6);
 #endif
+#endif
+#if OS_TIMER_QUEUE > 0
+	TEST_Add(test_timer_4);
+#endif
+	TEST_Add(test_timer_5);
 }
@@ -0,0 +1,36 @@
+#include "test.h"
+
+#if OS_TIMER_QUEUE > 0
+
+static unsigned counter;
+
+static void proc()
+{
+	                                             ASSERT(!port_isr_context());
+	                                             ASSERT(tmr_thisISR() == tmr1);
+	if (++counter == 1)
+	        tsk_delay(3); // the timer expires twice before the callback procedure is finished
+}
+
+static void test()
+{
+	unsigned event;
+
+	        counter = 0;
+	        tmr_getOverrun(tmr1);
+	        tmr_setDeferred(tmr1, true);
+	        tmr_startFrom(tmr1, 1, 1, proc);
+	event = tmr_wait(tmr1);                      ASSERT_success(event);
+	while  (counter < 2) tsk_delay(1);
+	        tmr_reset(tmr1);
+	                                             ASSERT(tmr_getOverrun(tmr1) > 0);
+	        tmr_setDeferred(tmr1, false);
+}
+
+void test_timer_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
+
+#endif
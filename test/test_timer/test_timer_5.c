@@ -0,0 +1,22 @@
+#include "test.h"
+
+static void test()
+{
+	unsigned event;
+	cnt_t    time;
+
+	        tmr_setSlack(tmr1, 3);
+	        tmr_start(tmr1, 2, 0);
+	        tmr_start(tmr2, 4, 0);
+	event = tmr_wait(tmr1);                      ASSERT_success(event);
+	time  = sys_time() - tmr1->start;            ASSERT(time >= 2 && time <= 2 + 3);
+	event = tmr_wait(tmr2);                      ASSERT_success(event);
+	time  = sys_time() - tmr2->start;            ASSERT(time >= 4);
+	        tmr_setSlack(tmr1, 0);
+}
+
+void test_timer_5()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,31 @@
+#include "test.h"
+
+#if OS_FUNCTIONAL
+
+static auto Tmr6 = Timer(nullptr);
+
+static unsigned value;
+
+static void test()
+{
+	unsigned event;
+	unsigned*ptr = &value;
+	unsigned add = 3;
+
+	        value = 1;
+	        Tmr6.startFrom(1, 0, [ptr, add]{ *ptr += add; }); // captured state travels in the delegate
+	event = Tmr6.wait();                         ASSERT_success(event);
+	                                             ASSERT(value == 4);
+	        Tmr6.startFrom(0, 0, [ptr]{ *ptr *= 2; });
+	event = Tmr6.wait();                         ASSERT_success(event);
+	                                             ASSERT(value == 8);
+}
+
+extern "C"
+void test_timer_6()
+{
+	TEST_Notify();
+	TEST_Call();
+}
+
+#endif
@@ -0,0 +1,14 @@
+#include "test.h"
+
+void test_timer_group()
+{
+	UNIT_Notify();
+	TEST_Add(test_timer_group_1);
+#ifndef __CSMC__
+	TEST_Add(test_timer_group_2);
+	TEST_Add(test_timer_group_3);
+#endif
+#if OS_TIMER_QUEUE > 0
+	TEST_Add(test_timer_group_4);
+#endif
+}
@@ -0,0 +1,46 @@
+#include "test.h"
+
+static unsigned sequence;
+
+static void proc1()
+{
+	                                             ASSERT(tmr_thisISR()->state == proc1);
+	        sequence = sequence * 10 + 1;
+}
+
+static void proc2()
+{
+	                                             ASSERT(tmr_thisISR()->state == proc2);
+	        sequence = sequence * 10 + 2;
+}
+
+static_TMG(tmg);
+static_TMR(tm1, proc1);
+static_TMR(tm2, proc2);
+static_TMR(tm3, 0);
+
+static void test()
+{
+	unsigned event;
+
+	        sequence = 0;
+	        tmg_insert(tmg, tm1);
+	        tmg_insert(tmg, tm2);
+	        tmg_insert(tmg, tm3);
+	        tmg_startPeriodic(tmg, 2);
+	event = tmr_wait(tm3);                       ASSERT_success(event);
+	                                             ASSERT(sequence == 12);
+	event = tmg_remove(tmg, tm1);                ASSERT_success(event);
+	event = tmg_remove(tmg, tm1);                ASSERT_failure(event);
+	event = tmr_wait(tm3);                       ASSERT_success(event);
+	                                             ASSERT(sequence == 122);
+	        tmg_reset(tmg);
+	                                             ASSERT_dead(tm2);
+	                                             ASSERT_dead(tm3);
+}
+
+void test_timer_group_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,35 @@
+#include "test.h"
+
+static unsigned sequence;
+
+static auto Grp = TimerGroup();
+static auto Tm1 = Timer([]{ sequence = sequence * 10 + 1; });
+static auto Tm2 = Timer([]{ sequence = sequence * 10 + 2; });
+static auto Tm3 = Timer(nullptr);
+
+static void test()
+{
+	unsigned event;
+
+	        sequence = 0;
+	        Grp.insert(&Tm1);
+	        Grp.insert(&Tm2);
+	        Grp.insert(&Tm3);
+	        Grp.startPeriodic(2);
+	event = Tm3.wait();                          ASSERT_success(event);
+	                                             ASSERT(sequence == 12);
+	event = Grp.remove(&Tm1);                    ASSERT_success(event);
+	event = Grp.remove(&Tm1);                    ASSERT_failure(event);
+	event = Tm3.wait();                          ASSERT_success(event);
+	                                             ASSERT(sequence == 122);
+	        Grp.reset();
+	                                             ASSERT(!Tm2);
+	                                             ASSERT(!Tm3);
+}
+
+extern "C"
+void test_timer_group_3()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,55 @@
+#include "test.h"
+
+#if OS_TIMER_QUEUE > 0
+
+static unsigned sequence;
+
+static_TMG(tmg4);
+static_TMR(tm41, 0);
+static_TMR(tm42, 0);
+static_TMR(tm43, 0);
+
+static void proc1()
+{
+	                                             ASSERT(!port_isr_context()); // launched by the deferred group
+	        sequence = sequence * 10 + 1;
+	        tmr_startFor(tm41, INFINITE);        // the timer leaves the group
+}
+
+static void proc2()
+{
+	                                             ASSERT(!port_isr_context()); // deferred member timer
+	                                             ASSERT(tmr_thisISR() == tm42);
+	        sequence = sequence * 10 + 2;
+}
+
+static void test()
+{
+	unsigned event;
+
+	        sequence = 0;
+	        tmr_init(tm41, proc1);
+	        tmr_init(tm42, proc2);
+	        tmg_insert(tmg4, tm41);
+	        tmg_insert(tmg4, tm42);
+	        tmg_insert(tmg4, tm43);
+	        tmr_setDeferred(&tmg4->tmr, true);
+	        tmr_setDeferred(tm42, true);
+	        tmg_start(tmg4, 1, 0);
+	event = tmr_wait(tm43);                      ASSERT_success(event);
+	while  (sequence < 12) tsk_delay(1);
+	                                             ASSERT(sequence == 12);
+	event = tmg_remove(tmg4, tm41);              ASSERT_failure(event);
+	        tmr_reset(tm41);
+	        tmg_reset(tmg4);
+	        tmr_setDeferred(&tmg4->tmr, false);
+	        tmr_setDeferred(tm42, false);
+}
+
+void test_timer_group_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
+
+#endif